@@ -0,0 +1,87 @@
+//
+//  After.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Scheduler/After.hpp>
+
+#include <thread>
+
+namespace Scheduler
+{
+	// A fiber waiting for a timer to fire, with a fine timer resolution so that the timer fires on the next iteration.
+	static Benchmark::Registration after("after/wait", [](Benchmark::Sampler & sampler){
+		Reactor::Bound bound(Duration(0.000001));
+		
+		const std::size_t batch = 100;
+		
+		Fiber fiber([&](){
+			After after(0);
+			
+			sampler.start();
+			
+			while (!sampler.done()) {
+				for (std::size_t i = 0; i < batch; i += 1) {
+					after.wait();
+				}
+				
+				sampler.sample(batch);
+			}
+		});
+		
+		fiber.transfer();
+		bound.reactor.run();
+	});
+	
+	struct Count
+	{
+		std::size_t * count = nullptr;
+		
+		void operator()() {*count += 1;}
+		explicit operator bool() const noexcept {return count != nullptr;}
+	};
+	
+	// Scheduling and cancelling a timeout, e.g. for an operation which completes before its timeout.
+	static Benchmark::Registration schedule_cancel("wheel/schedule-cancel", [](Benchmark::Sampler & sampler){
+		Wheel<Count> wheel;
+		std::size_t count = 0;
+		
+		const std::size_t batch = 1000;
+		
+		sampler.start();
+		
+		while (!sampler.done()) {
+			for (std::size_t i = 0; i < batch; i += 1) {
+				auto event = wheel.schedule(Duration(1), Count{&count});
+				event.cancel();
+			}
+			
+			sampler.sample(batch);
+		}
+	});
+	
+	// Firing many timers which expire on the same tick.
+	static Benchmark::Registration fire("wheel/fire", [](Benchmark::Sampler & sampler){
+		Wheel<Count> wheel(Duration(0.000001));
+		std::size_t count = 0;
+		
+		const std::size_t batch = 1000;
+		
+		while (!sampler.done()) {
+			for (std::size_t i = 0; i < batch; i += 1) {
+				wheel.schedule(Duration(0), Count{&count});
+			}
+			
+			std::this_thread::sleep_for(std::chrono::microseconds(2));
+			
+			sampler.start();
+			wheel.run();
+			sampler.sample(batch);
+		}
+	});
+}
@@ -0,0 +1,84 @@
+//
+//  Benchmark.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Scheduler/Histogram.hpp>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Scheduler
+{
+	namespace Benchmark
+	{
+		// Records the time per operation of each sample, where a sample is a batch of operations.
+		class Sampler final
+		{
+		public:
+			Sampler(std::size_t samples) : _samples(samples) {}
+			
+			// The number of samples which should be taken.
+			std::size_t samples() const noexcept {return _samples;}
+			
+			bool done() const noexcept {return _histogram.count() >= _samples;}
+			
+			// Start timing, after any setup.
+			void start() {_last = Clock::now();}
+			
+			// Record the time since the previous sample (or start) as a sample of the specified number of operations.
+			void sample(std::size_t operations)
+			{
+				auto now = Clock::now();
+				auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(now - _last);
+				
+				_histogram.record(duration.count() * 1000 / operations);
+				_operations += operations;
+				_duration += duration;
+				
+				_last = now;
+			}
+			
+			// Picoseconds per operation.
+			const Histogram & histogram() const noexcept {return _histogram;}
+			
+			std::size_t operations() const noexcept {return _operations;}
+			std::chrono::nanoseconds duration() const noexcept {return _duration;}
+		
+		private:
+			using Clock = std::chrono::steady_clock;
+			
+			std::size_t _samples;
+			
+			Histogram _histogram;
+			std::size_t _operations = 0;
+			std::chrono::nanoseconds _duration{0};
+			
+			Clock::time_point _last;
+		};
+		
+		using Function = std::function<void(Sampler &)>;
+		
+		struct Entry {
+			std::string name;
+			Function function;
+		};
+		
+		std::vector<Entry> & registry();
+		
+		// Register a benchmark with the main program.
+		struct Registration {
+			Registration(const char * name, Function function)
+			{
+				registry().push_back({name, function});
+			}
+		};
+	}
+}
@@ -0,0 +1,83 @@
+//
+//  Channel.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Scheduler/Reactor.hpp>
+#include <Scheduler/Channel.hpp>
+
+namespace Scheduler
+{
+	// A producer and consumer passing one value at a time.
+	static Benchmark::Registration single("channel/single", [](Benchmark::Sampler & sampler){
+		Reactor::Bound bound;
+		Channel<std::size_t, 64> channel;
+		
+		const std::size_t batch = 1000;
+		
+		Fiber consumer([&](){
+			std::size_t count = 0;
+			
+			while (channel.receive()) {
+				count += 1;
+				if (count % batch == 0) sampler.sample(batch);
+			}
+		});
+		
+		Fiber producer([&](){
+			sampler.start();
+			
+			for (std::size_t i = 0; !sampler.done(); i += 1) {
+				channel.send(i);
+			}
+			
+			channel.close();
+		});
+		
+		consumer.transfer();
+		producer.transfer();
+		bound.reactor.run();
+	});
+	
+	// A producer and consumer passing batches of values.
+	static Benchmark::Registration many("channel/many", [](Benchmark::Sampler & sampler){
+		Reactor::Bound bound;
+		Channel<std::size_t, 64> channel;
+		
+		const std::size_t batch = 1000, size = 32;
+		
+		Fiber consumer([&](){
+			std::size_t values[size], count = 0;
+			
+			while (auto received = channel.receive_many(values, size)) {
+				count += received;
+				
+				if (count >= batch) {
+					sampler.sample(count);
+					count = 0;
+				}
+			}
+		});
+		
+		Fiber producer([&](){
+			std::size_t values[size] = {0};
+			
+			sampler.start();
+			
+			while (!sampler.done()) {
+				channel.send_many(values, size);
+			}
+			
+			channel.close();
+		});
+		
+		consumer.transfer();
+		producer.transfer();
+		bound.reactor.run();
+	});
+}
@@ -0,0 +1,74 @@
+//
+//  Handler.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Scheduler/Handler.hpp>
+#include <Scheduler/Monitor.hpp>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <system_error>
+
+namespace Scheduler
+{
+	// Round trips of one byte between a fiber and a handler which echoes from the reactor's stack. This is directly comparable to "monitor/ping-pong", where the echo runs in a second fiber.
+	static Benchmark::Registration ping_pong("handler/ping-pong", [](Benchmark::Sampler & sampler){
+		Reactor::Bound bound;
+		
+		int descriptors[2];
+		
+		if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, descriptors) == -1)
+			throw std::system_error(errno, std::generic_category(), "socketpair");
+		
+		Handle first(descriptors[0]), second(descriptors[1]);
+		
+		const std::size_t batch = 100;
+		
+		// Echo bytes until a zero byte is received:
+		Handler server([&](int){
+			char byte;
+			
+			while (::read(second, &byte, 1) == 1) {
+				::write(second, &byte, 1);
+				
+				if (byte == 0) return;
+			}
+			
+			server.watch(bound.reactor, second, Monitor::READABLE);
+		});
+		
+		server.watch(bound.reactor, second, Monitor::READABLE);
+		
+		Fiber client([&](){
+			Monitor monitor(first);
+			char byte = 1;
+			
+			sampler.start();
+			
+			while (!sampler.done()) {
+				for (std::size_t i = 0; i < batch; i += 1) {
+					::write(first, &byte, 1);
+					
+					while (::read(first, &byte, 1) != 1) {
+						monitor.wait_readable();
+					}
+				}
+				
+				sampler.sample(batch);
+			}
+			
+			byte = 0;
+			::write(first, &byte, 1);
+		});
+		
+		client.transfer();
+		bound.reactor.run();
+	});
+}
@@ -0,0 +1,177 @@
+//
+//  Monitor.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Scheduler/Monitor.hpp>
+#include <Scheduler/After.hpp>
+
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <memory>
+#include <system_error>
+
+namespace Scheduler
+{
+	struct SocketPair
+	{
+		Handle first, second;
+		
+		SocketPair()
+		{
+			int descriptors[2];
+			
+			if (::socketpair(AF_UNIX, SOCK_STREAM, 0, descriptors) == -1)
+				throw std::system_error(errno, std::generic_category(), "socketpair");
+			
+			first = Handle(descriptors[0]);
+			second = Handle(descriptors[1]);
+			
+			update_flags(first, O_NONBLOCK);
+			update_flags(second, O_NONBLOCK);
+		}
+	};
+	
+	// Echo bytes until a zero byte is received.
+	static void echo(Descriptor descriptor)
+	{
+		Monitor monitor(descriptor);
+		char byte = 1;
+		
+		while (byte) {
+			if (::read(descriptor, &byte, 1) == 1) {
+				::write(descriptor, &byte, 1);
+			} else {
+				monitor.wait_readable();
+			}
+		}
+	}
+	
+	static void receive(Monitor & monitor, Descriptor descriptor)
+	{
+		char byte;
+		
+		while (::read(descriptor, &byte, 1) != 1) {
+			monitor.wait_readable();
+		}
+	}
+	
+	// Round trips of one byte between two fibers over a socket pair.
+	static Benchmark::Registration ping_pong("monitor/ping-pong", [](Benchmark::Sampler & sampler){
+		Reactor::Bound bound;
+		SocketPair pair;
+		
+		const std::size_t batch = 100;
+		
+		Fiber server([&](){
+			echo(pair.second);
+		});
+		
+		server.transfer();
+		
+		Fiber client([&](){
+			Monitor monitor(pair.first);
+			char byte = 1;
+			
+			sampler.start();
+			
+			while (!sampler.done()) {
+				for (std::size_t i = 0; i < batch; i += 1) {
+					::write(pair.first, &byte, 1);
+					receive(monitor, pair.first);
+				}
+				
+				sampler.sample(batch);
+			}
+			
+			byte = 0;
+			::write(pair.first, &byte, 1);
+		});
+		
+		client.transfer();
+		bound.reactor.run();
+	});
+	
+	// Round trips over several active socket pairs, while many other fibers wait on timers and descriptors which never become ready.
+	static Benchmark::Registration idle("monitor/idle", [](Benchmark::Sampler & sampler){
+		Reactor::Bound bound;
+		
+		const std::size_t ACTIVE = 8, TIMERS = 10000;
+		
+		// Each idle descriptor needs a socket pair, so stay well within the descriptor limit:
+		struct rlimit limit;
+		::getrlimit(RLIMIT_NOFILE, &limit);
+		std::size_t descriptors = std::min<std::size_t>(1000, (limit.rlim_cur - 64) / 2);
+		
+		std::vector<std::unique_ptr<Fiber>> fibers;
+		std::vector<std::unique_ptr<SocketPair>> pairs;
+		
+		// Idle fibers are transient, so the reactor doesn't wait for them:
+		for (std::size_t i = 0; i < TIMERS; i += 1) {
+			fibers.push_back(std::make_unique<Fiber>([]{
+				Fiber::current->transient = true;
+				After(3600).wait();
+			}, 1024*64));
+			
+			fibers.back()->transfer();
+		}
+		
+		for (std::size_t i = 0; i < descriptors + ACTIVE; i += 1) {
+			pairs.push_back(std::make_unique<SocketPair>());
+			
+			auto descriptor = Descriptor(pairs.back()->second);
+			bool active = i >= descriptors;
+			
+			fibers.push_back(std::make_unique<Fiber>([descriptor, active]{
+				if (!active) Fiber::current->transient = true;
+				echo(descriptor);
+			}, 1024*64));
+			
+			fibers.back()->transfer();
+		}
+		
+		Fiber client([&](){
+			std::vector<Monitor> monitors;
+			
+			for (std::size_t i = descriptors; i < pairs.size(); i += 1) {
+				monitors.emplace_back(pairs[i]->first);
+			}
+			
+			char byte = 1;
+			
+			sampler.start();
+			
+			while (!sampler.done()) {
+				for (std::size_t i = descriptors; i < pairs.size(); i += 1) {
+					::write(pairs[i]->first, &byte, 1);
+				}
+				
+				for (std::size_t i = descriptors; i < pairs.size(); i += 1) {
+					receive(monitors[i - descriptors], pairs[i]->first);
+				}
+				
+				sampler.sample(ACTIVE);
+			}
+			
+			byte = 0;
+			
+			for (std::size_t i = descriptors; i < pairs.size(); i += 1) {
+				::write(pairs[i]->first, &byte, 1);
+			}
+		});
+		
+		client.transfer();
+		bound.reactor.run();
+		
+		// Stop the idle fibers before closing the descriptors they are waiting on:
+		fibers.clear();
+	});
+}
@@ -0,0 +1,65 @@
+//
+//  Reactor.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Scheduler/Reactor.hpp>
+
+namespace Scheduler
+{
+	// Round trips through the ready list: the fiber transfers to the target, which returns to the reactor, which resumes the fiber.
+	static Benchmark::Registration transfer("reactor/transfer", [](Benchmark::Sampler & sampler){
+		Reactor::Bound bound;
+		auto & reactor = bound.reactor;
+		
+		const std::size_t batch = 1000;
+		
+		Fiber target([&](){
+			Fiber::current->transient = true;
+			
+			while (true) {
+				reactor.transfer();
+			}
+		});
+		
+		target.transfer();
+		
+		Fiber fiber([&](){
+			sampler.start();
+			
+			while (!sampler.done()) {
+				for (std::size_t i = 0; i < batch; i += 1) {
+					reactor.transfer(&target);
+				}
+				
+				sampler.sample(batch);
+			}
+		});
+		
+		fiber.transfer();
+		reactor.run();
+	});
+	
+	// Starting a fiber from the reactor's fiber pool, which runs to completion.
+	static Benchmark::Registration spawn("reactor/spawn", [](Benchmark::Sampler & sampler){
+		Reactor::Bound bound;
+		auto & reactor = bound.reactor;
+		
+		const std::size_t batch = 1000;
+		
+		sampler.start();
+		
+		while (!sampler.done()) {
+			for (std::size_t i = 0; i < batch; i += 1) {
+				reactor.spawn([]{});
+			}
+			
+			sampler.sample(batch);
+		}
+	});
+}
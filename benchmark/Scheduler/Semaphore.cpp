@@ -0,0 +1,138 @@
+//
+//  Semaphore.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Scheduler/Reactor.hpp>
+#include <Scheduler/Semaphore.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace Scheduler
+{
+	static Benchmark::Registration uncontended("semaphore/uncontended", [](Benchmark::Sampler & sampler){
+		Reactor::Bound bound;
+		Semaphore semaphore;
+		
+		const std::size_t batch = 1000;
+		
+		Fiber fiber([&](){
+			sampler.start();
+			
+			while (!sampler.done()) {
+				for (std::size_t i = 0; i < batch; i += 1) {
+					semaphore.acquire();
+					semaphore.release();
+				}
+				
+				sampler.sample(batch);
+			}
+		});
+		
+		fiber.transfer();
+		bound.reactor.run();
+	});
+	
+	// Several fibers competing for the semaphore. Each one yields while holding it, so the others must wait.
+	static void contended(Benchmark::Sampler & sampler, Semaphore::Mode mode)
+	{
+		Reactor::Bound bound;
+		auto & reactor = bound.reactor;
+		
+		Semaphore semaphore(1, mode);
+		
+		const std::size_t FIBERS = 4, batch = 100;
+		std::size_t count = 0;
+		
+		std::vector<std::unique_ptr<Fiber>> fibers;
+		
+		sampler.start();
+		
+		for (std::size_t i = 0; i < FIBERS; i += 1) {
+			fibers.push_back(std::make_unique<Fiber>([&](){
+				while (!sampler.done()) {
+					semaphore.acquire();
+					
+					// Yield to the reactor, which resumes the other fibers first:
+					reactor.transfer(&Fiber::main);
+					
+					semaphore.release();
+					
+					count += 1;
+					if (count % batch == 0) sampler.sample(batch);
+				}
+			}));
+			
+			fibers.back()->transfer();
+		}
+		
+		reactor.run();
+	}
+	
+	static Benchmark::Registration contended_transfer("semaphore/contended/transfer", [](Benchmark::Sampler & sampler){
+		contended(sampler, Semaphore::Mode::TRANSFER);
+	});
+	
+	static Benchmark::Registration contended_ready("semaphore/contended/ready", [](Benchmark::Sampler & sampler){
+		contended(sampler, Semaphore::Mode::READY);
+	});
+	
+	static Benchmark::Registration contended_handoff("semaphore/contended/handoff", [](Benchmark::Sampler & sampler){
+		contended(sampler, Semaphore::Mode::HANDOFF);
+	});
+	
+	// One fiber waking many waiting fibers, per waiter woken.
+	static void broadcast(Benchmark::Sampler & sampler, Semaphore::Mode mode)
+	{
+		Reactor::Bound bound;
+		auto & reactor = bound.reactor;
+		
+		Semaphore semaphore(0, mode);
+		
+		const std::size_t FIBERS = 1000;
+		bool done = false;
+		
+		std::vector<std::unique_ptr<Fiber>> fibers;
+		
+		for (std::size_t i = 0; i < FIBERS; i += 1) {
+			fibers.push_back(std::make_unique<Fiber>([&](){
+				while (!done) semaphore.wait();
+			}));
+			
+			fibers.back()->transfer();
+		}
+		
+		Fiber signaller([&](){
+			sampler.start();
+			
+			while (!sampler.done()) {
+				semaphore.broadcast();
+				
+				// Yield to the reactor, so that the woken fibers can wait again:
+				reactor.transfer(&Fiber::main);
+				
+				sampler.sample(FIBERS);
+			}
+			
+			done = true;
+			semaphore.broadcast();
+		});
+		
+		signaller.transfer();
+		reactor.run();
+	}
+	
+	static Benchmark::Registration broadcast_transfer("semaphore/broadcast/transfer", [](Benchmark::Sampler & sampler){
+		broadcast(sampler, Semaphore::Mode::TRANSFER);
+	});
+	
+	static Benchmark::Registration broadcast_ready("semaphore/broadcast/ready", [](Benchmark::Sampler & sampler){
+		broadcast(sampler, Semaphore::Mode::READY);
+	});
+}
@@ -0,0 +1,98 @@
+//
+//  Stream.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Scheduler/Reactor.hpp>
+#include <Scheduler/Stream.hpp>
+
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include <system_error>
+
+namespace Scheduler
+{
+	static std::pair<Handle, Handle> socket_pair()
+	{
+		Descriptor descriptors[2];
+		
+		if (::socketpair(AF_LOCAL, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, descriptors) == -1)
+			throw std::system_error(errno, std::generic_category(), "socketpair");
+		
+		return {Handle(descriptors[0]), Handle(descriptors[1])};
+	}
+	
+	static const char message[] = "GET / HTTP/1.1\r\n";
+	
+	// Small messages, each written with its own system call.
+	static Benchmark::Registration unbuffered("stream/unbuffered", [](Benchmark::Sampler & sampler){
+		Reactor::Bound bound;
+		auto sockets = socket_pair();
+		
+		const std::size_t batch = 1000;
+		
+		Fiber consumer([&](){
+			Stream stream(std::move(sockets.first));
+			std::size_t count = 0;
+			
+			while (stream.read_until("\r\n")) {
+				count += 1;
+				if (count % batch == 0) sampler.sample(batch);
+			}
+		});
+		
+		Fiber producer([&](){
+			Stream stream(std::move(sockets.second), 0);
+			
+			sampler.start();
+			
+			while (!sampler.done()) {
+				stream.write(message, sizeof(message) - 1);
+			}
+		});
+		
+		consumer.transfer();
+		producer.transfer();
+		bound.reactor.run();
+	});
+	
+	// Small messages, which are queued and written together.
+	static Benchmark::Registration buffered("stream/buffered", [](Benchmark::Sampler & sampler){
+		Reactor::Bound bound;
+		auto sockets = socket_pair();
+		
+		const std::size_t batch = 1000;
+		
+		Fiber consumer([&](){
+			Stream stream(std::move(sockets.first));
+			std::size_t count = 0;
+			
+			while (stream.read_until("\r\n")) {
+				count += 1;
+				if (count % batch == 0) sampler.sample(batch);
+			}
+		});
+		
+		Fiber producer([&](){
+			Stream stream(std::move(sockets.second));
+			
+			sampler.start();
+			
+			while (!sampler.done()) {
+				stream.write(message, sizeof(message) - 1);
+			}
+			
+			stream.flush();
+		});
+		
+		consumer.transfer();
+		producer.transfer();
+		bound.reactor.run();
+	});
+}
@@ -0,0 +1,98 @@
+//
+//  Transfer.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Scheduler/Reactor.hpp>
+#include <Scheduler/Transfer.hpp>
+#include <Scheduler/IO.hpp>
+
+#include <sys/socket.h>
+
+#include <system_error>
+#include <vector>
+
+namespace Scheduler
+{
+	static std::pair<Handle, Handle> socket_pair()
+	{
+		Descriptor descriptors[2];
+		
+		if (::socketpair(AF_LOCAL, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, descriptors) == -1)
+			throw std::system_error(errno, std::generic_category(), "socketpair");
+		
+		return {Handle(descriptors[0]), Handle(descriptors[1])};
+	}
+	
+	// Proxy 64KiB blocks from one socket to another, using the specified function, and sample the time per block.
+	template <typename Proxy>
+	static void proxy(Benchmark::Sampler & sampler, Proxy proxy)
+	{
+		Reactor::Bound bound;
+		auto source = socket_pair(), destination = socket_pair();
+		
+		const std::size_t block = 1024 * 64;
+		
+		Fiber writer([&](){
+			std::vector<char> buffer(block);
+			
+			sampler.start();
+			
+			while (!sampler.done()) {
+				for (std::size_t offset = 0; offset < block;) {
+					offset += IO::write(source.second, buffer.data() + offset, block - offset);
+				}
+			}
+			
+			source.second.close();
+		});
+		
+		Fiber middle([&](){
+			proxy(source.first, destination.second);
+			
+			destination.second.close();
+		});
+		
+		Fiber reader([&](){
+			std::vector<char> buffer(block);
+			std::size_t count = 0;
+			
+			while (auto size = IO::read(destination.first, buffer.data(), buffer.size())) {
+				count += size;
+				
+				if (count >= block) {
+					sampler.sample(1);
+					count -= block;
+				}
+			}
+		});
+		
+		reader.transfer();
+		middle.transfer();
+		writer.transfer();
+		bound.reactor.run();
+	}
+	
+	static Benchmark::Registration splice("transfer/splice", [](Benchmark::Sampler & sampler){
+		proxy(sampler, [](Descriptor from, Descriptor to){
+			transfer(from, to);
+		});
+	});
+	
+	static Benchmark::Registration copy("transfer/copy", [](Benchmark::Sampler & sampler){
+		proxy(sampler, [](Descriptor from, Descriptor to){
+			std::vector<char> buffer(1024 * 64);
+			
+			while (auto size = IO::read(from, buffer.data(), buffer.size())) {
+				for (std::size_t offset = 0; offset < size;) {
+					offset += IO::write(to, buffer.data() + offset, size - offset);
+				}
+			}
+		});
+	});
+}
@@ -0,0 +1,98 @@
+//
+//  main.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace Scheduler
+{
+	namespace Benchmark
+	{
+		std::vector<Entry> & registry()
+		{
+			static std::vector<Entry> entries;
+			return entries;
+		}
+	}
+}
+
+using namespace Scheduler;
+
+static double nanoseconds(std::uint64_t picoseconds)
+{
+	return picoseconds / 1000.0;
+}
+
+// Usage: Scheduler-benchmark [--samples count] [filter...]
+// Runs every benchmark whose name contains one of the filters, and writes the results to stdout as JSON. Times are nanoseconds per operation.
+int main(int argc, char ** argv)
+{
+	std::size_t samples = 1000;
+	std::vector<std::string> filters;
+	
+	for (int i = 1; i < argc; i += 1) {
+		if (std::strcmp(argv[i], "--samples") == 0 && i + 1 < argc) {
+			samples = std::strtoul(argv[++i], nullptr, 10);
+		} else {
+			filters.push_back(argv[i]);
+		}
+	}
+	
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "{\"benchmarks\": [";
+	
+	bool first = true;
+	
+	// Registration order depends on link order, so sort the benchmarks to make the output repeatable:
+	auto & registry = Benchmark::registry();
+	std::sort(registry.begin(), registry.end(), [](auto & a, auto & b){return a.name < b.name;});
+	
+	for (auto & entry : registry) {
+		if (!filters.empty()) {
+			bool matched = false;
+			
+			for (auto & filter : filters) {
+				if (entry.name.find(filter) != std::string::npos) matched = true;
+			}
+			
+			if (!matched) continue;
+		}
+		
+		std::cerr << entry.name << "..." << std::endl;
+		
+		Benchmark::Sampler sampler(samples);
+		entry.function(sampler);
+		
+		auto & histogram = sampler.histogram();
+		double mean = sampler.operations() ? double(sampler.duration().count()) / sampler.operations() : 0;
+		
+		if (!first) std::cout << ",";
+		first = false;
+		
+		std::cout << "\n\t{\"name\": \"" << entry.name << "\""
+			<< ", \"unit\": \"ns\""
+			<< ", \"samples\": " << histogram.count()
+			<< ", \"operations\": " << sampler.operations()
+			<< ", \"mean\": " << mean
+			<< ", \"min\": " << nanoseconds(histogram.min())
+			<< ", \"p50\": " << nanoseconds(histogram.value_at(0.5))
+			<< ", \"p99\": " << nanoseconds(histogram.value_at(0.99))
+			<< ", \"p999\": " << nanoseconds(histogram.value_at(0.999))
+			<< ", \"max\": " << nanoseconds(histogram.max())
+			<< "}";
+	}
+	
+	std::cout << "\n]}" << std::endl;
+	
+	return 0;
+}
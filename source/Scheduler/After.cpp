@@ -35,6 +35,6 @@ namespace Scheduler
 		auto reactor = Reactor::current;
 		assert(reactor);
 		
-		reactor->sleep(Fiber::current, until);
+		reactor->sleep(Fiber::current, until, _slack ? &*_slack : nullptr);
 	}
 }
@@ -10,12 +10,17 @@
 
 #include "Reactor.hpp"
 
+#include <optional>
+
 namespace Scheduler
 {
 	class After final
 	{
 	public:
 		After(Duration duration) : _duration(duration) {}
+		
+		// The wakeup may be deferred by up to `slack`, so that it can be coalesced with other timers.
+		After(Duration duration, Duration slack) : _duration(duration), _slack(slack) {}
 		~After() {}
 		
 		After(const After &) = delete;
@@ -25,7 +30,11 @@ namespace Scheduler
 		
 		void wait(const Timestamp & until);
 		
+		const Duration & duration() const noexcept {return _duration;}
+		const std::optional<Duration> & slack() const noexcept {return _slack;}
+	
 	private:
 		Duration _duration;
+		std::optional<Duration> _slack;
 	};
 }
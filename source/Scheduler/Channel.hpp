@@ -0,0 +1,224 @@
+//
+//  Channel.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Reactor.hpp"
+#include "List.hpp"
+
+#include <array>
+#include <cassert>
+#include <optional>
+
+namespace Scheduler
+{
+	// A bounded queue of values between fibers on the same reactor. Values are stored in a fixed ring buffer of `N` entries; senders wait while it's full and receivers wait while it's empty. A value sent to a waiting receiver is handed to it directly, without going through the buffer.
+	// Waiting fibers are woken via the reactor's ready list rather than by transferring to them, so a batch of values can be sent or received per wakeup. If `N` is 0, every send waits for a receiver.
+	template <typename T, std::size_t N>
+	class Channel final
+	{
+	public:
+		Channel() {}
+		
+		~Channel()
+		{
+			close();
+		}
+		
+		Channel(const Channel &) = delete;
+		Channel & operator=(const Channel &) = delete;
+		
+		std::size_t size() const noexcept {return _size;}
+		static constexpr std::size_t capacity() noexcept {return N;}
+		
+		bool closed() const noexcept {return _closed;}
+		
+		// Wake all waiting fibers. Subsequent sends fail, and receives fail once the buffer is empty.
+		void close()
+		{
+			_closed = true;
+			
+			while (auto waiter = _senders.pop_front()) wake(waiter);
+			while (auto waiter = _receivers.pop_front()) wake(waiter);
+		}
+		
+		// @returns false if the channel was closed.
+		bool send(T value)
+		{
+			return send_many(&value, 1) == 1;
+		}
+		
+		// Send all the values, which are moved from, waiting while the buffer is full.
+		// @returns the number of values sent, which is less than `count` only if the channel was closed or the fiber's deadline expired.
+		std::size_t send_many(T * values, std::size_t count)
+		{
+			if (_closed) return 0;
+			
+			std::size_t sent = 0;
+			
+			// Receivers only wait when the buffer is empty, so values can be handed to them directly:
+			while (sent < count) {
+				auto waiter = _receivers.front();
+				if (!waiter) break;
+				
+				while (sent < count && waiter->done < waiter->count) {
+					waiter->values[waiter->done++] = std::move(values[sent++]);
+				}
+				
+				if (waiter->done == waiter->count) {
+					_receivers.pop_front();
+					wake(waiter);
+				}
+			}
+			
+			// Only buffer values if no other senders are waiting, to preserve the order:
+			if constexpr (N > 0) {
+				if (_senders.empty()) {
+					while (sent < count && _size < N) {
+						push(std::move(values[sent++]));
+					}
+				}
+			}
+			
+			if (sent < count) {
+				Waiter waiter(values + sent, count - sent);
+				_senders.push_back(waiter);
+				
+				// Receivers take the remaining values, and wake us once they are all gone:
+				wait();
+				
+				sent += waiter.done;
+			}
+			
+			// Receivers which were only partly filled are woken once there's nothing more to send:
+			if (auto waiter = _receivers.front()) {
+				if (waiter->done) {
+					_receivers.pop_front();
+					wake(waiter);
+				}
+			}
+			
+			return sent;
+		}
+		
+		// @returns the next value, or nothing if the channel was closed and is empty, or the fiber's deadline expired.
+		std::optional<T> receive()
+		{
+			T value;
+			
+			if (receive_many(&value, 1)) {
+				return std::optional<T>(std::move(value));
+			}
+			
+			return std::nullopt;
+		}
+		
+		// Receive up to `limit` values, waiting until at least one is available.
+		// @returns the number of values received, or 0 if the channel was closed and is empty, or the fiber's deadline expired.
+		std::size_t receive_many(T * values, std::size_t limit)
+		{
+			std::size_t received = take(values, limit);
+			
+			if (received || _closed || limit == 0) return received;
+			
+			Waiter waiter(values, limit);
+			_receivers.push_back(waiter);
+			
+			// Senders hand values to us directly, and wake us once they have no more to send or our batch is full:
+			wait();
+			
+			return waiter.done;
+		}
+	
+	private:
+		struct Waiter : public Link {
+			Reactor::Ready ready;
+			
+			// The values to send, or where to store received values:
+			T * values;
+			std::size_t count;
+			
+			// The number of values sent or received so far:
+			std::size_t done = 0;
+			
+			Waiter(T * values_, std::size_t count_) : values(values_), count(count_) {}
+			
+			~Waiter()
+			{
+				if (linked()) unlink();
+			}
+		};
+		
+		std::array<T, N> _buffer;
+		std::size_t _head = 0, _size = 0;
+		
+		bool _closed = false;
+		
+		List<Waiter> _senders, _receivers;
+		
+		void push(T && value)
+		{
+			_buffer[(_head + _size) % N] = std::move(value);
+			_size += 1;
+		}
+		
+		T pop()
+		{
+			T value = std::move(_buffer[_head]);
+			
+			_head = (_head + 1) % N;
+			_size -= 1;
+			
+			return value;
+		}
+		
+		// Take values from the buffer, refilling it from waiting senders, or directly from waiting senders if there is no buffer.
+		std::size_t take(T * values, std::size_t limit)
+		{
+			std::size_t received = 0;
+			
+			while (received < limit) {
+				auto waiter = _senders.front();
+				
+				if constexpr (N == 0) {
+					if (!waiter) break;
+					
+					values[received++] = std::move(waiter->values[waiter->done++]);
+				} else {
+					if (_size) values[received++] = pop();
+					
+					if (!waiter) {
+						if (_size) continue; else break;
+					}
+					
+					// Senders only wait while the buffer is full, so there's space for one of their values:
+					push(std::move(waiter->values[waiter->done++]));
+				}
+				
+				if (waiter->done == waiter->count) {
+					_senders.pop_front();
+					wake(waiter);
+				}
+			}
+			
+			return received;
+		}
+		
+		void wait()
+		{
+			assert(Reactor::current);
+			Reactor::current->transfer();
+		}
+		
+		void wake(Waiter * waiter)
+		{
+			assert(Reactor::current);
+			Reactor::current->ready(waiter->ready);
+		}
+	};
+}
@@ -0,0 +1,50 @@
+//
+//  Deadline.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Deadline.hpp"
+
+#include <cassert>
+
+namespace Scheduler
+{
+	static Reactor & current_reactor()
+	{
+		assert(Reactor::current);
+		
+		return *Reactor::current;
+	}
+	
+	Deadline::Deadline(const Duration & timeout) : _reactor(current_reactor()), _outer(_reactor._deadline), _registration(-1, nullptr)
+	{
+		auto timespec = timeout.as_timespec();
+		_time = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(timespec.tv_sec) + std::chrono::nanoseconds(timespec.tv_nsec));
+		
+		if (_outer && _outer->_effective->_time <= _time) {
+			_effective = _outer->_effective;
+		} else {
+			_registration.schedule(_reactor, timeout);
+		}
+		
+		_reactor._deadline = this;
+	}
+	
+	Deadline::~Deadline()
+	{
+		_reactor._deadline = _outer;
+	}
+	
+	Duration Deadline::remaining() const
+	{
+		if (expired()) return Duration(0);
+		
+		auto remaining = _effective->_time - Clock::now();
+		if (remaining.count() < 0) return Duration(0);
+		
+		return Duration(std::chrono::duration<double>(remaining).count());
+	}
+}
@@ -0,0 +1,56 @@
+//
+//  Deadline.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Reactor.hpp"
+
+#include <chrono>
+
+namespace Scheduler
+{
+	// A deadline which applies to every wait by the current fiber while the scope exists. The scope schedules a single timer, which resumes the fiber from whatever it is waiting on when it expires. Once it has expired, waits fail immediately, e.g. `Monitor::wait` times out and `Semaphore::acquire` returns false.
+	// If an enclosing scope has an earlier deadline, it applies instead, and no timer is scheduled.
+	class Deadline final
+	{
+	public:
+		Deadline(const Duration & timeout);
+		~Deadline();
+		
+		Deadline(const Deadline &) = delete;
+		Deadline & operator=(const Deadline &) = delete;
+		
+		// Whether the deadline which applies to the scope has expired.
+		bool expired() const noexcept {return _effective->_registration.result == 0;}
+		
+		// The time remaining until the deadline which applies to the scope, which is zero once it has expired.
+		Duration remaining() const;
+		
+		// The innermost scope of the running fiber, if any.
+		static Deadline * current() noexcept
+		{
+			return Reactor::current ? Reactor::current->_deadline : nullptr;
+		}
+	
+	private:
+		friend class Reactor;
+		
+		using Clock = std::chrono::steady_clock;
+		
+		Reactor & _reactor;
+		Deadline * _outer;
+		
+		// The scope whose deadline applies, which is either this one or an enclosing scope.
+		Deadline * _effective = this;
+		
+		Clock::time_point _time;
+		
+		// Only has a fiber while the fiber is waiting. The result becomes 0 when the timer fires.
+		Reactor::Registration _registration;
+	};
+}
@@ -0,0 +1,150 @@
+//
+//  Deque.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Scheduler
+{
+	// A lock-free Chase-Lev work stealing deque of pointers. The owning thread pushes and pops at the bottom, while any other thread can steal from the top.
+	// Based on "Correct and Efficient Work-Stealing for Weak Memory Models" by Lê, Pop, Cohen and Zappa Nardelli.
+	template <typename T>
+	class Deque final
+	{
+		static_assert(std::is_pointer<T>::value, "Deque can only contain pointers.");
+		
+		struct Array
+		{
+			std::int64_t capacity;
+			std::unique_ptr<std::atomic<T>[]> items;
+			
+			Array(std::int64_t capacity_) : capacity(capacity_), items(new std::atomic<T>[capacity_]) {}
+			
+			T get(std::int64_t index) const noexcept
+			{
+				return items[index & (capacity - 1)].load(std::memory_order_relaxed);
+			}
+			
+			void put(std::int64_t index, T item) noexcept
+			{
+				items[index & (capacity - 1)].store(item, std::memory_order_relaxed);
+			}
+		};
+		
+		alignas(64) std::atomic<std::int64_t> _top{0};
+		alignas(64) std::atomic<std::int64_t> _bottom{0};
+		std::atomic<Array *> _array;
+		
+		// Arrays are only released when the deque is destroyed, because a thief may still be reading from one after it has been replaced.
+		std::vector<std::unique_ptr<Array>> _arrays;
+		
+		Array * grow(Array * array, std::int64_t bottom, std::int64_t top)
+		{
+			auto larger = std::make_unique<Array>(array->capacity * 2);
+			
+			for (auto index = top; index < bottom; index += 1) {
+				larger->put(index, array->get(index));
+			}
+			
+			array = larger.get();
+			_arrays.push_back(std::move(larger));
+			_array.store(array, std::memory_order_release);
+			
+			return array;
+		}
+	
+	public:
+		Deque(std::int64_t capacity = 64)
+		{
+			_arrays.push_back(std::make_unique<Array>(capacity));
+			_array.store(_arrays.back().get(), std::memory_order_relaxed);
+		}
+		
+		Deque(const Deque &) = delete;
+		Deque & operator=(const Deque &) = delete;
+		
+		// An estimate, unless called by the owner.
+		bool empty() const noexcept
+		{
+			return _bottom.load(std::memory_order_relaxed) <= _top.load(std::memory_order_relaxed);
+		}
+		
+		// Only called by the owner.
+		void push(T item)
+		{
+			auto bottom = _bottom.load(std::memory_order_relaxed);
+			auto top = _top.load(std::memory_order_acquire);
+			auto array = _array.load(std::memory_order_relaxed);
+			
+			if (bottom - top > array->capacity - 1) {
+				array = grow(array, bottom, top);
+			}
+			
+			array->put(bottom, item);
+			
+			std::atomic_thread_fence(std::memory_order_release);
+			_bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+		
+		// Only called by the owner.
+		// @returns the most recently pushed item, or nullptr if the deque is empty.
+		T pop()
+		{
+			auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+			auto array = _array.load(std::memory_order_relaxed);
+			
+			_bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			
+			auto top = _top.load(std::memory_order_relaxed);
+			
+			if (top > bottom) {
+				_bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+			
+			auto item = array->get(bottom);
+			
+			// This was the last item, so we race with thieves for it:
+			if (top == bottom) {
+				if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+					item = nullptr;
+				}
+				
+				_bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+			
+			return item;
+		}
+		
+		// Can be called by any thread.
+		// @returns the least recently pushed item, or nullptr if the deque is empty or another thread won the race.
+		T steal()
+		{
+			auto top = _top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			auto bottom = _bottom.load(std::memory_order_acquire);
+			
+			if (top >= bottom) return nullptr;
+			
+			auto array = _array.load(std::memory_order_acquire);
+			auto item = array->get(top);
+			
+			if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+				return nullptr;
+			}
+			
+			return item;
+		}
+	};
+}
@@ -0,0 +1,260 @@
+//
+//  FiberPool.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "FiberPool.hpp"
+#include "Defer.hpp"
+#include "Reactor.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+namespace Scheduler
+{
+	struct FiberPool::Worker : public Fiber, public Link {
+		FiberPool * pool;
+		Class * size_class;
+		
+		std::function<void()> function;
+		
+		// Addresses on the stack, recorded when the fiber starts and when it becomes idle, so that the unused part of the stack can be estimated from outside the fiber:
+		std::uintptr_t top = 0;
+		std::uintptr_t low = 0;
+		
+		bool trimmed = false;
+		bool reaping = false;
+		
+		// The number of times the function has waited on the reactor, while metrics were enabled:
+		std::uint64_t waits = 0;
+		
+		Worker(FiberPool * pool_, Class * size_class_) : Fiber([this]{run();}, size_class_->stack_size), pool(pool_), size_class(size_class_) {}
+		
+		void run();
+		
+		// The part of the stack below `address` which is certainly unused, excluding a margin for frames we can't see (e.g. the fiber entry point and context switch), aligned to `alignment`.
+		std::pair<std::uintptr_t, std::uintptr_t> unused(std::uintptr_t address, std::uintptr_t alignment) const;
+	};
+	
+	static std::uintptr_t page_size()
+	{
+		static const std::uintptr_t size = ::sysconf(_SC_PAGESIZE);
+		return size;
+	}
+	
+	std::pair<std::uintptr_t, std::uintptr_t> FiberPool::Worker::unused(std::uintptr_t address, std::uintptr_t alignment) const
+	{
+		auto margin = page_size() * 4;
+		
+		auto start = top - size_class->stack_size + margin;
+		auto end = address - margin;
+		
+		start = (start + alignment - 1) & ~(alignment - 1);
+		end = end & ~(alignment - 1);
+		
+		if (end <= start) return {0, 0};
+		
+		return {start, end};
+	}
+	
+	void FiberPool::Worker::run()
+	{
+		char marker;
+		top = reinterpret_cast<std::uintptr_t>(&marker);
+
+#if defined(MADV_HUGEPAGE)
+		if (pool->_huge_pages) {
+			auto range = unused(top, 1024*1024*2);
+			
+			// This is only advice, so failure is not an error:
+			if (range.first) ::madvise(reinterpret_cast<void *>(range.first), range.second - range.first, MADV_HUGEPAGE);
+		}
+#endif
+		
+		// If the function throws, or the fiber is stopped, it can't be reused:
+		auto defer_retire = defer([&]{
+			if (!reaping) pool->retire(this);
+		});
+		
+		while (true) {
+			{
+				auto function = std::move(this->function);
+				this->function = nullptr;
+				
+				auto reactor = Reactor::current;
+				
+				waits = 0;
+				if (reactor) reactor->set_waits(&waits);
+				
+				// The counter must not outlive the fiber, even if the function throws:
+				auto defer_waits = defer([&]{
+					if (reactor && reactor->waits() == &waits) reactor->set_waits(nullptr);
+				});
+				
+				function();
+			}
+			
+			char marker;
+			low = reinterpret_cast<std::uintptr_t>(&marker);
+			
+			pool->release(this);
+			
+			Fiber::main.transfer();
+		}
+	}
+	
+	FiberPool::FiberPool(std::vector<std::size_t> sizes)
+	{
+		if (sizes.empty())
+			throw std::invalid_argument("FiberPool requires at least one size class");
+		
+		std::sort(sizes.begin(), sizes.end());
+		
+		for (auto size : sizes) {
+			_classes.push_back(std::make_unique<Class>(size));
+		}
+	}
+	
+	FiberPool::~FiberPool()
+	{
+		reap();
+		
+		for (auto & size_class : _classes) {
+			while (auto worker = size_class->idle.pop_front()) {
+				_retired.push_back(*worker);
+			}
+		}
+		
+		while (auto worker = _active.pop_front()) {
+			_retired.push_back(*worker);
+		}
+		
+		reap();
+	}
+	
+	Fiber * FiberPool::acquire(std::function<void()> function, std::size_t stack_size)
+	{
+		if (!_retired.empty()) reap();
+		
+		Class * size_class = nullptr;
+		
+		for (auto & candidate : _classes) {
+			if (candidate->stack_size >= stack_size) {
+				size_class = candidate.get();
+				break;
+			}
+		}
+		
+		if (size_class == nullptr)
+			throw std::invalid_argument("stack size exceeds the largest size class");
+		
+		// The most recently used fiber is most likely to have a warm stack:
+		auto worker = size_class->idle.pop_back();
+		
+		if (worker) {
+			size_class->count -= 1;
+			worker->trimmed = false;
+		} else {
+			worker = new Worker(this, size_class);
+			_size += 1;
+		}
+		
+		worker->function = std::move(function);
+		_active.push_back(*worker);
+		
+		return worker;
+	}
+	
+	std::uint64_t FiberPool::waits(const Fiber * fiber) const noexcept
+	{
+		return static_cast<const Worker *>(fiber)->waits;
+	}
+	
+	void FiberPool::release(Worker * worker)
+	{
+		worker->unlink();
+		
+		auto size_class = worker->size_class;
+		
+		if (size_class->count >= _limit) {
+			_retired.push_back(*worker);
+		} else {
+			size_class->idle.push_back(*worker);
+			size_class->count += 1;
+		}
+	}
+	
+	void FiberPool::retire(Worker * worker)
+	{
+		if (worker->linked()) worker->unlink();
+		
+		_retired.push_back(*worker);
+	}
+	
+	void FiberPool::reap()
+	{
+		while (auto worker = _retired.pop_front()) {
+			worker->reaping = true;
+			delete worker;
+			
+			_size -= 1;
+		}
+	}
+	
+	std::size_t FiberPool::trim()
+	{
+		if (_trim == Trim::NONE) return 0;
+		
+		bool free = (_trim == Trim::FREE);
+		
+		auto release = [&](std::pair<std::uintptr_t, std::uintptr_t> range){
+			auto address = reinterpret_cast<void *>(range.first);
+			auto size = range.second - range.first;
+
+#if defined(MADV_FREE)
+			if (free && ::madvise(address, size, MADV_FREE) == 0) return;
+#endif
+			
+			// The kernel doesn't support MADV_FREE, so fall back:
+			free = false;
+			::madvise(address, size, MADV_DONTNEED);
+		};
+		
+		std::size_t total = 0;
+		
+		for (auto & size_class : _classes) {
+			for (auto worker = size_class->idle.front(); worker; worker = size_class->idle.next(worker)) {
+				if (!worker->trimmed) {
+					auto range = worker->unused(worker->low, page_size());
+					
+					if (range.first) {
+						release(range);
+						total += range.second - range.first;
+					}
+					
+					worker->trimmed = true;
+				}
+			}
+		}
+		
+		return total;
+	}
+	
+	std::size_t FiberPool::idle() const noexcept
+	{
+		std::size_t count = 0;
+		
+		for (auto & size_class : _classes) {
+			count += size_class->count;
+		}
+		
+		return count;
+	}
+}
@@ -0,0 +1,99 @@
+//
+//  FiberPool.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Fiber.hpp"
+#include "List.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Scheduler
+{
+	// Recycles fibers (and therefore their stacks and guard pages), so that starting a fiber is a free list pop rather than allocating a stack.
+	// A pooled fiber runs one function at a time. When the function returns, the fiber becomes idle and transfers to the main fiber (i.e. the reactor), rather than to whichever fiber resumed it last.
+	class FiberPool final
+	{
+	public:
+		enum class Trim {
+			// Idle stacks keep their memory.
+			NONE,
+			
+			// Idle stacks are released immediately, and will be zero filled when used again.
+			DONTNEED,
+			
+			// Idle stacks are released lazily if there is memory pressure. Falls back to DONTNEED if unsupported.
+			FREE,
+		};
+		
+		// Fibers are allocated in size classes, in ascending order.
+		FiberPool(std::vector<std::size_t> sizes = {1024*64, 1024*256, 1024*1024});
+		
+		// All fibers are destroyed, including any which are still running.
+		~FiberPool();
+		
+		FiberPool(const FiberPool &) = delete;
+		FiberPool & operator=(const FiberPool &) = delete;
+		
+		// The maximum number of idle fibers kept in each size class. Fibers which become idle beyond this limit are destroyed.
+		void set_limit(std::size_t limit) noexcept {_limit = limit;}
+		
+		// How idle stacks are released by `trim`.
+		void set_trim(Trim trim) noexcept {_trim = trim;}
+		
+		// Advise the kernel to back new stacks with huge pages. Only stacks larger than a huge page can benefit.
+		void set_huge_pages(bool huge_pages) noexcept {_huge_pages = huge_pages;}
+		
+		// Take an idle fiber from the smallest size class with at least `stack_size` bytes, or create one. Transfer to the fiber to run the function.
+		Fiber * acquire(std::function<void()> function, std::size_t stack_size = 0);
+		
+		// Release the unused memory of stacks which have been idle since the last trim.
+		// @returns the number of bytes released.
+		std::size_t trim();
+		
+		// The number of times the fiber has waited on a reactor with metrics enabled, since it was acquired. The fiber must belong to this pool.
+		std::uint64_t waits(const Fiber * fiber) const noexcept;
+		
+		// The number of fibers which have been created and not destroyed.
+		std::size_t size() const noexcept {return _size;}
+		
+		// The number of fibers waiting to be reused.
+		std::size_t idle() const noexcept;
+	
+	private:
+		struct Worker;
+		
+		struct Class {
+			std::size_t stack_size;
+			List<Worker> idle;
+			std::size_t count = 0;
+			
+			Class(std::size_t stack_size_) : stack_size(stack_size_) {}
+		};
+		
+		std::vector<std::unique_ptr<Class>> _classes;
+		
+		List<Worker> _active;
+		
+		// Fibers which finished abnormally or exceeded the limit, and can be destroyed once they are no longer running.
+		List<Worker> _retired;
+		
+		std::size_t _size = 0;
+		std::size_t _limit = 1024;
+		Trim _trim = Trim::NONE;
+		bool _huge_pages = false;
+		
+		void release(Worker * worker);
+		void retire(Worker * worker);
+		void reap();
+	};
+}
@@ -7,6 +7,7 @@
 //
 
 #include "Handle.hpp"
+#include "Reactor.hpp"
 
 #include <unistd.h>
 #include <fcntl.h>
@@ -68,6 +69,11 @@ namespace Scheduler
 	void Handle::close()
 	{
 		if (_descriptor != -1) {
+			// The descriptor number may be reused, so any registration must be removed first:
+			if (Reactor::current) {
+				Reactor::current->forget(_descriptor);
+			}
+			
 			auto result = ::close(_descriptor);
 			
 			// Note that the return value should only be used for diagnostics. In particular close() should not be retried after an EINTR since this may cause a reused descriptor from another thread to be closed.
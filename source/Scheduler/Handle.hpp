@@ -41,10 +41,11 @@ namespace Scheduler
 		
 		operator Descriptor() const {return _descriptor;}
 		
+		// Close the descriptor, first removing its registration from the current reactor, which should be the one that waited on it.
 		void close();
 		
 		explicit operator bool() const {return _descriptor != -1;}
-		
+	
 	protected:
 		Descriptor _descriptor = -1;
 	};
@@ -0,0 +1,72 @@
+//
+//  Handler.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Handler.hpp"
+
+namespace Scheduler
+{
+	void Handler::watch(Reactor & reactor, Descriptor descriptor, int events, const Timestamp * timeout)
+	{
+		cancel();
+		
+		if (auto ready = reactor.watch(descriptor, events, *this)) {
+			// The edge was consumed before we were watching, so we must not wait for another one:
+			arm(reactor);
+			result = ready;
+			reactor.ready(*this);
+			
+			return;
+		}
+		
+		arm(reactor);
+		_descriptor = descriptor;
+		
+		if (timeout) {
+			schedule(reactor, *timeout, reactor.slack());
+		}
+	}
+	
+	void Handler::after(Reactor & reactor, const Timestamp & timeout, const Duration * slack)
+	{
+		cancel();
+		
+		schedule(reactor, timeout, slack ? *slack : reactor.slack());
+		arm(reactor);
+	}
+	
+	void Handler::cancel() noexcept
+	{
+		if (!_reactor) return;
+		
+		if (_descriptor != -1) {
+			_reactor->unwatch(_descriptor, *this);
+			_descriptor = -1;
+		}
+		
+		timeout_event.cancel();
+		if (linked()) unlink();
+		
+		_reactor->remove_waiting();
+		_reactor = nullptr;
+	}
+	
+	void Handler::arm(Reactor & reactor) noexcept
+	{
+		_reactor = &reactor;
+		_reactor->add_waiting();
+	}
+	
+	void Handler::fire(void * context)
+	{
+		auto handler = static_cast<Handler *>(context);
+		
+		// Disarm the handler first, so that the function can re-arm it:
+		handler->cancel();
+		handler->_invoke(handler->_storage, handler->result);
+	}
+}
@@ -0,0 +1,82 @@
+//
+//  Handler.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Reactor.hpp"
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace Scheduler
+{
+	// A function which is invoked directly by the reactor when a descriptor becomes ready or a timer expires, without a fiber or a coroutine. The function is stored inline, so arming a handler never allocates, and it runs on the reactor's stack as soon as the event is dispatched, without a context switch. This suits short, non-blocking work like accepting connections or bumping counters.
+	// The function is invoked with the events which occurred, or 0 if the timeout expired. It must not suspend, and it may re-arm the handler, but it must not destroy it. Readiness is only reported when it changes, so the function should read or write until the descriptor would block before re-arming. A handler is invoked at most once each time it's armed.
+	class Handler final : public Reactor::Registration
+	{
+	public:
+		enum : std::size_t {
+			// The most space the function (i.e. its captures) may use:
+			CAPACITY = 48,
+		};
+		
+		template <typename Function>
+		Handler(Function function) : Registration(0, nullptr)
+		{
+			static_assert(sizeof(Function) <= CAPACITY, "The function is too big to be stored inline!");
+			static_assert(alignof(Function) <= alignof(std::max_align_t), "The function is over-aligned!");
+			
+			new (_storage) Function(std::move(function));
+			
+			_invoke = [](void * storage, int result){(*static_cast<Function *>(storage))(result);};
+			_destroy = [](void * storage){static_cast<Function *>(storage)->~Function();};
+			
+			callback = &Handler::fire;
+			context = this;
+			immediate = true;
+		}
+		
+		~Handler()
+		{
+			cancel();
+			_destroy(_storage);
+		}
+		
+		Handler(const Handler &) = delete;
+		Handler & operator=(const Handler &) = delete;
+		
+		// Whether the handler is waiting for an event.
+		bool armed() const noexcept {return _reactor != nullptr;}
+		
+		// Invoke the function when the descriptor becomes ready for the events, or with 0 if the timeout expires first. If the descriptor is already ready, the function is invoked by the next iteration of the event loop. The reactor keeps running while the handler is armed.
+		// @throws std::system_error with EBUSY if something else is already waiting on the descriptor.
+		void watch(Reactor & reactor, Descriptor descriptor, int events, const Timestamp * timeout = nullptr);
+		
+		// Invoke the function with 0 once the timeout expires. The timer may be deferred by up to `slack` (or the reactor's slack if not specified) so that it can be coalesced with other timers.
+		void after(Reactor & reactor, const Timestamp & timeout, const Duration * slack = nullptr);
+		
+		// Stop waiting, without invoking the function.
+		void cancel() noexcept;
+	
+	private:
+		alignas(std::max_align_t) unsigned char _storage[CAPACITY];
+		
+		void (*_invoke)(void * storage, int result);
+		void (*_destroy)(void * storage);
+		
+		// The reactor while the handler is armed, and the descriptor it's watching, if any:
+		Reactor * _reactor = nullptr;
+		Descriptor _descriptor = -1;
+		
+		void arm(Reactor & reactor) noexcept;
+		
+		// Invoked by the reactor when the event occurs.
+		static void fire(void * context);
+	};
+}
@@ -0,0 +1,103 @@
+//
+//  Histogram.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace Scheduler
+{
+	// A log-linear histogram, like an HDR histogram. Values are grouped by their power of two, and each power of two is divided into linear sub-buckets, so the relative error of any quantile is at most 1/SUB_BUCKETS. Recording is O(1) and never allocates.
+	class Histogram final
+	{
+	public:
+		enum : std::size_t {
+			SUB_BITS = 4,
+			SUB_BUCKETS = 1 << SUB_BITS,
+			BUCKETS = (64 - SUB_BITS + 1) * SUB_BUCKETS,
+		};
+		
+		void record(std::uint64_t value) noexcept
+		{
+			_counts[index(value)] += 1;
+			_count += 1;
+			
+			if (value > _max) _max = value;
+			if (_count == 1 || value < _min) _min = value;
+		}
+		
+		std::uint64_t count() const noexcept {return _count;}
+		std::uint64_t min() const noexcept {return _min;}
+		std::uint64_t max() const noexcept {return _max;}
+		
+		// @returns the largest value which is equivalent to the value at the specified quantile (0 to 1).
+		std::uint64_t value_at(double quantile) const noexcept
+		{
+			if (_count == 0) return 0;
+			
+			std::uint64_t rank = quantile * _count;
+			if (rank >= _count) rank = _count - 1;
+			
+			std::uint64_t total = 0;
+			
+			for (std::size_t index = 0; index < BUCKETS; index += 1) {
+				total += _counts[index];
+				
+				if (total > rank) {
+					auto value = highest(index);
+					return value < _max ? value : _max;
+				}
+			}
+			
+			return _max;
+		}
+		
+		void merge(const Histogram & other) noexcept
+		{
+			for (std::size_t index = 0; index < BUCKETS; index += 1) {
+				_counts[index] += other._counts[index];
+			}
+			
+			if (other._count) {
+				if (_count == 0 || other._min < _min) _min = other._min;
+				if (other._max > _max) _max = other._max;
+			}
+			
+			_count += other._count;
+		}
+		
+		void reset() noexcept
+		{
+			*this = Histogram();
+		}
+	
+	private:
+		std::array<std::uint64_t, BUCKETS> _counts = {};
+		std::uint64_t _count = 0, _min = 0, _max = 0;
+		
+		static std::size_t index(std::uint64_t value) noexcept
+		{
+			if (value < SUB_BUCKETS) return value;
+			
+			std::size_t shift = (63 - __builtin_clzll(value)) - SUB_BITS;
+			
+			return (shift + 1) * SUB_BUCKETS + ((value >> shift) & (SUB_BUCKETS - 1));
+		}
+		
+		static std::uint64_t highest(std::size_t index) noexcept
+		{
+			if (index < SUB_BUCKETS) return index;
+			
+			std::size_t shift = index / SUB_BUCKETS - 1;
+			std::uint64_t lowest = std::uint64_t(SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+			
+			return lowest + ((std::uint64_t(1) << shift) - 1);
+		}
+	};
+}
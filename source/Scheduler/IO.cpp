@@ -0,0 +1,216 @@
+//
+//  IO.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "IO.hpp"
+#include "Reactor.hpp"
+#include "Monitor.hpp"
+
+#include <unistd.h>
+#include <errno.h>
+#include <cassert>
+
+#include <system_error>
+
+namespace Scheduler
+{
+	namespace IO
+	{
+#if defined(SCHEDULER_URING)
+		// Submit the operation prepared by the callback and wait for it to complete.
+		// @returns the result of the operation, or throws std::system_error.
+		template <typename Prepare>
+		static int operate(Reactor * reactor, const File & file, const char * name, Prepare prepare)
+		{
+			Reactor::Operation operation;
+			
+			auto entry = reactor->submission(operation);
+			prepare(entry);
+			
+			if (file.index >= 0) {
+				entry->fd = file.index;
+				entry->flags |= IOSQE_FIXED_FILE;
+			} else {
+				entry->fd = file.descriptor;
+			}
+			
+			auto result = reactor->complete(operation);
+			
+			if (result < 0)
+				throw std::system_error(-result, std::generic_category(), name);
+			
+			return result;
+		}
+#endif
+		
+		// Attempt the operation, waiting for the descriptor to become ready if it would block.
+		template <typename Attempt>
+		static auto attempt(Reactor * reactor, const File & file, Monitor::Event event, const char * name, Attempt attempt)
+		{
+			while (true) {
+				auto result = attempt();
+				
+				if (result != -1) return result;
+				
+				if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					// The wait only fails if the fiber's deadline expired:
+					if (reactor->wait(file.descriptor, event) == 0)
+						throw std::system_error(ETIMEDOUT, std::generic_category(), name);
+				} else if (errno != EINTR) {
+					throw std::system_error(errno, std::generic_category(), name);
+				}
+			}
+		}
+		
+		std::size_t read(File file, void * buffer, std::size_t size, [[maybe_unused]] int index)
+		{
+			auto reactor = Reactor::current;
+			assert(reactor);
+
+#if defined(SCHEDULER_URING)
+			if (reactor->completions()) {
+				return operate(reactor, file, "read", [&](struct io_uring_sqe * entry){
+					entry->opcode = index >= 0 ? IORING_OP_READ_FIXED : IORING_OP_READ;
+					entry->addr = reinterpret_cast<std::uintptr_t>(buffer);
+					entry->len = size;
+					entry->off = -1;
+					entry->buf_index = index >= 0 ? index : 0;
+				});
+			}
+#endif
+			
+			return attempt(reactor, file, Monitor::READABLE, "read", [&]{
+				return ::read(file.descriptor, buffer, size);
+			});
+		}
+		
+		std::size_t write(File file, const void * buffer, std::size_t size, [[maybe_unused]] int index)
+		{
+			auto reactor = Reactor::current;
+			assert(reactor);
+
+#if defined(SCHEDULER_URING)
+			if (reactor->completions()) {
+				return operate(reactor, file, "write", [&](struct io_uring_sqe * entry){
+					entry->opcode = index >= 0 ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+					entry->addr = reinterpret_cast<std::uintptr_t>(buffer);
+					entry->len = size;
+					entry->off = -1;
+					entry->buf_index = index >= 0 ? index : 0;
+				});
+			}
+#endif
+			
+			return attempt(reactor, file, Monitor::WRITABLE, "write", [&]{
+				return ::write(file.descriptor, buffer, size);
+			});
+		}
+		
+		Descriptor accept(File file, struct sockaddr * address, socklen_t * length, int flags)
+		{
+			auto reactor = Reactor::current;
+			assert(reactor);
+
+#if defined(SCHEDULER_URING)
+			if (reactor->completions()) {
+				return operate(reactor, file, "accept", [&](struct io_uring_sqe * entry){
+					entry->opcode = IORING_OP_ACCEPT;
+					entry->addr = reinterpret_cast<std::uintptr_t>(address);
+					entry->addr2 = reinterpret_cast<std::uintptr_t>(length);
+					entry->accept_flags = flags;
+				});
+			}
+#endif
+			
+			return attempt(reactor, file, Monitor::READABLE, "accept", [&]{
+#if defined(SOCK_NONBLOCK)
+				return ::accept4(file.descriptor, address, length, flags);
+#else
+				return ::accept(file.descriptor, address, length);
+#endif
+			});
+		}
+		
+		void connect(File file, const struct sockaddr * address, socklen_t length)
+		{
+			auto reactor = Reactor::current;
+			assert(reactor);
+
+#if defined(SCHEDULER_URING)
+			if (reactor->completions()) {
+				operate(reactor, file, "connect", [&](struct io_uring_sqe * entry){
+					entry->opcode = IORING_OP_CONNECT;
+					entry->addr = reinterpret_cast<std::uintptr_t>(address);
+					entry->off = length;
+				});
+				
+				return;
+			}
+#endif
+			
+			if (::connect(file.descriptor, address, length) == 0) return;
+			
+			if (errno != EINPROGRESS && errno != EINTR)
+				throw std::system_error(errno, std::generic_category(), "connect");
+			
+			// A non-blocking connect completes when the socket becomes writable:
+			if (reactor->wait(file.descriptor, Monitor::WRITABLE) == 0)
+				throw std::system_error(ETIMEDOUT, std::generic_category(), "connect");
+			
+			int error = 0;
+			socklen_t size = sizeof(error);
+			
+			if (::getsockopt(file.descriptor, SOL_SOCKET, SO_ERROR, &error, &size) == -1)
+				throw std::system_error(errno, std::generic_category(), "getsockopt");
+			
+			if (error)
+				throw std::system_error(error, std::generic_category(), "connect");
+		}
+		
+		std::size_t recvmsg(File file, struct msghdr * message, int flags)
+		{
+			auto reactor = Reactor::current;
+			assert(reactor);
+
+#if defined(SCHEDULER_URING)
+			if (reactor->completions()) {
+				return operate(reactor, file, "recvmsg", [&](struct io_uring_sqe * entry){
+					entry->opcode = IORING_OP_RECVMSG;
+					entry->addr = reinterpret_cast<std::uintptr_t>(message);
+					entry->len = 1;
+					entry->msg_flags = flags;
+				});
+			}
+#endif
+			
+			return attempt(reactor, file, Monitor::READABLE, "recvmsg", [&]{
+				return ::recvmsg(file.descriptor, message, flags);
+			});
+		}
+		
+		std::size_t sendmsg(File file, const struct msghdr * message, int flags)
+		{
+			auto reactor = Reactor::current;
+			assert(reactor);
+
+#if defined(SCHEDULER_URING)
+			if (reactor->completions()) {
+				return operate(reactor, file, "sendmsg", [&](struct io_uring_sqe * entry){
+					entry->opcode = IORING_OP_SENDMSG;
+					entry->addr = reinterpret_cast<std::uintptr_t>(message);
+					entry->len = 1;
+					entry->msg_flags = flags;
+				});
+			}
+#endif
+			
+			return attempt(reactor, file, Monitor::WRITABLE, "sendmsg", [&]{
+				return ::sendmsg(file.descriptor, message, flags);
+			});
+		}
+	}
+}
@@ -0,0 +1,51 @@
+//
+//  IO.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Handle.hpp"
+
+#include <cstddef>
+#include <sys/socket.h>
+
+namespace Scheduler
+{
+	// Operations which suspend the current fiber until they complete. When the reactor supports completions (i.e. io_uring), the operation is submitted to the kernel and the fiber is resumed with the result. Otherwise, the operation is attempted directly and the fiber waits for readiness if it would block, so the descriptor should be non-blocking.
+	// Errors are reported by throwing std::system_error.
+	namespace IO
+	{
+		// A descriptor, which may also have been registered with Reactor::register_files.
+		struct File
+		{
+			Descriptor descriptor;
+			
+			// The index in the registered file table, or -1.
+			int index = -1;
+			
+			File(Descriptor descriptor_, int index_ = -1) : descriptor(descriptor_), index(index_) {}
+			File(const Handle & handle, int index_ = -1) : descriptor(handle), index(index_) {}
+		};
+		
+		// Read into the buffer, which may be one of the buffers registered with Reactor::register_buffers.
+		// @returns the number of bytes read, which is 0 at the end of the file.
+		std::size_t read(File file, void * buffer, std::size_t size, int index = -1);
+		
+		// Write from the buffer, which may be one of the buffers registered with Reactor::register_buffers.
+		// @returns the number of bytes written.
+		std::size_t write(File file, const void * buffer, std::size_t size, int index = -1);
+		
+		// The flags are as for `accept4`, where it is supported.
+		// @returns the accepted descriptor, which the caller is responsible for closing.
+		Descriptor accept(File file, struct sockaddr * address = nullptr, socklen_t * length = nullptr, int flags = 0);
+		
+		void connect(File file, const struct sockaddr * address, socklen_t length);
+		
+		std::size_t recvmsg(File file, struct msghdr * message, int flags = 0);
+		std::size_t sendmsg(File file, const struct msghdr * message, int flags = 0);
+	}
+}
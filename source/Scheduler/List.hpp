@@ -0,0 +1,100 @@
+//
+//  List.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+namespace Scheduler
+{
+	// A link in an intrusive list. Nodes typically live on the stack of a waiting fiber, so adding and removing them never allocates.
+	struct Link
+	{
+		Link * previous = nullptr;
+		Link * next = nullptr;
+		
+		Link() {}
+		
+		// Nodes can't be moved while they are linked.
+		Link(const Link &) = delete;
+		Link & operator=(const Link &) = delete;
+		
+		bool linked() const noexcept {return next != nullptr;}
+		
+		// Remove the node from whatever list it is in.
+		void unlink() noexcept
+		{
+			previous->next = next;
+			next->previous = previous;
+			
+			previous = next = nullptr;
+		}
+	};
+	
+	// A circular, doubly linked, intrusive list of nodes derived from Link. Every operation is O(1).
+	template <typename Node>
+	class List final
+	{
+		Link _head;
+	
+	public:
+		List()
+		{
+			_head.previous = _head.next = &_head;
+		}
+		
+		List(const List &) = delete;
+		List & operator=(const List &) = delete;
+		
+		bool empty() const noexcept {return _head.next == &_head;}
+		
+		Node * front() const noexcept
+		{
+			return empty() ? nullptr : static_cast<Node *>(_head.next);
+		}
+		
+		// The node after the specified node, or nullptr if it is the last node.
+		Node * next(const Node * node) const noexcept
+		{
+			const Link * link = node;
+			
+			return link->next == &_head ? nullptr : static_cast<Node *>(link->next);
+		}
+		
+		void push_back(Node & node) noexcept
+		{
+			Link & link = node;
+			
+			link.previous = _head.previous;
+			link.next = &_head;
+			
+			_head.previous->next = &link;
+			_head.previous = &link;
+		}
+		
+		// Remove and return the first node, or nullptr if the list is empty.
+		Node * pop_front() noexcept
+		{
+			if (empty()) return nullptr;
+			
+			auto node = static_cast<Node *>(_head.next);
+			node->unlink();
+			
+			return node;
+		}
+		
+		// Remove and return the last node, or nullptr if the list is empty.
+		Node * pop_back() noexcept
+		{
+			if (empty()) return nullptr;
+			
+			auto node = static_cast<Node *>(_head.previous);
+			node->unlink();
+			
+			return node;
+		}
+	};
+}
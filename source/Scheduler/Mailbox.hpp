@@ -0,0 +1,84 @@
+//
+//  Mailbox.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Reactor.hpp"
+#include "Defer.hpp"
+
+#include <cassert>
+#include <deque>
+#include <optional>
+
+namespace Scheduler
+{
+	// An unbounded queue of messages for a fiber, which can be sent from any thread, e.g. from another core of a `Runtime`. Each message is posted to the mailbox's reactor, so senders never take a lock, and messages which arrive together share one wakeup.
+	// The mailbox belongs to the reactor which was current when it was created, and is received from by one fiber at a time on that reactor. It must outlive every send, and messages must be copyable, since they are posted as a `std::function`.
+	template <typename T>
+	class Mailbox final
+	{
+	public:
+		Mailbox(Reactor * reactor = Reactor::current) : _reactor(reactor)
+		{
+			assert(_reactor);
+		}
+		
+		Mailbox(const Mailbox &) = delete;
+		Mailbox & operator=(const Mailbox &) = delete;
+		
+		Reactor * reactor() const noexcept {return _reactor;}
+		
+		// The number of messages which have been delivered but not received.
+		std::size_t size() const noexcept {return _messages.size();}
+		
+		// Send the message. This is safe to call from any thread.
+		void send(T message)
+		{
+			_reactor->post([this, message = std::move(message)]() mutable {
+				deliver(std::move(message));
+			});
+		}
+		
+		// Wait until a message is delivered.
+		// @returns the message, or nothing if the fiber's deadline expired.
+		std::optional<T> receive()
+		{
+			assert(Reactor::current == _reactor);
+			
+			while (_messages.empty()) {
+				assert(_receiver == nullptr);
+				
+				Reactor::Ready ready;
+				_receiver = &ready;
+				
+				auto defer_clear = defer([&]{_receiver = nullptr;});
+				
+				if (!_reactor->transfer()) return std::nullopt;
+			}
+			
+			T message = std::move(_messages.front());
+			_messages.pop_front();
+			
+			return std::optional<T>(std::move(message));
+		}
+	
+	private:
+		Reactor * _reactor;
+		
+		std::deque<T> _messages;
+		Reactor::Ready * _receiver = nullptr;
+		
+		// Invoked on the mailbox's reactor.
+		void deliver(T && message)
+		{
+			_messages.push_back(std::move(message));
+			
+			if (_receiver) _reactor->ready(*_receiver);
+		}
+	};
+}
@@ -7,7 +7,6 @@
 //
 
 #include "Monitor.hpp"
-#include "Defer.hpp"
 
 #include <Concurrent/Fiber.hpp>
 
@@ -18,6 +17,14 @@ namespace Scheduler
 {
 	using namespace Concurrent;
 	
+	Monitor & Monitor::operator=(Monitor && other)
+	{
+		_descriptor = other._descriptor;
+		other._descriptor = -1;
+		
+		return *this;
+	}
+	
 	Monitor::Event Monitor::wait_readable(const Timestamp * timeout)
 	{
 		return this->wait(Event::READABLE, timeout);
@@ -27,62 +34,13 @@ namespace Scheduler
 	{
 		return this->wait(Event::WRITABLE, timeout);
 	}
-			
-#if defined(SCHEDULER_KQUEUE)
-	Monitor::Event Monitor::wait(Event events, const Timestamp * timeout)
-	{
-		assert(Fiber::current);
-		assert(Reactor::current);
-		auto reactor = Reactor::current;
-		
-		Reactor::Registration registration;
-		
-		reactor->append({
-			static_cast<uintptr_t>(_descriptor),
-			events,
-			EV_ADD | EV_CLEAR | EV_ONESHOT | EV_UDATA_SPECIFIC,
-			0,
-			0,
-			&registration
-		}, false);
-		
-		auto defer_removal = defer([&]{
-			reactor->append({
-				static_cast<uintptr_t>(_descriptor),
-				events,
-				EV_DELETE | EV_UDATA_SPECIFIC,
-				0,
-				0,
-				&registration
-			});
-		});
-		
-		reactor->transfer();
-		
-		if (registration.result) {
-			defer_removal.cancel();
-		}
-		
-		return Event(registration.result);
-	}
-#elif defined(SCHEDULER_EPOLL)
+	
 	Monitor::Event Monitor::wait(Event events, const Timestamp * timeout)
 	{
 		assert(Fiber::current);
 		assert(Reactor::current);
 		auto reactor = Reactor::current;
 		
-		Reactor::Registration registration;
-		
-		reactor->append(EPOLL_CTL_ADD, _descriptor, events | EPOLLET | EPOLLONESHOT, &registration, timeout);
-		
-		auto defer_removal = defer([&]{
-			reactor->append(EPOLL_CTL_DEL, _descriptor, 0, nullptr, nullptr);
-		});
-		
-		reactor->transfer();
-		
-		return Event(registration.result);
+		return Event(reactor->wait(_descriptor, events, timeout));
 	}
-#endif
 }
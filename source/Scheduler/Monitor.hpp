@@ -17,19 +17,16 @@ namespace Scheduler
 	public:
 		Monitor(Descriptor descriptor) : _descriptor(descriptor) {}
 		
+		// The monitor doesn't own the descriptor, and each wait removes its own registration, so the descriptor stays registered with the reactor (and may be in use elsewhere) until the owning `Handle` is closed. Descriptors should be closed through `Handle` on the reactor's thread; if one is closed some other way and its number is reused, the reactor re-registers it the next time it is waited on.
+		~Monitor() = default;
+		
 		Monitor(Monitor && other) :
 			_descriptor(other._descriptor)
 		{
 			other._descriptor = -1;
 		}
 		
-		Monitor & operator=(Monitor && other)
-		{
-			_descriptor = other._descriptor;
-			other._descriptor = -1;
-			
-			return *this;
-		}
+		Monitor & operator=(Monitor && other);
 		
 		Monitor(const Monitor &) = delete;
 		Monitor & operator=(const Monitor &) = delete;
@@ -51,9 +48,19 @@ namespace Scheduler
 		Event wait_readable(const Timestamp * timeout = nullptr);
 		Event wait_writable(const Timestamp * timeout = nullptr);
 		
+		// The events to wait for, which a coroutine can `co_await` (see Task.hpp).
+		struct Readiness {
+			Descriptor descriptor;
+			Event events;
+			const Timestamp * timeout;
+		};
+		
+		Readiness readable(const Timestamp * timeout = nullptr) const noexcept {return {_descriptor, READABLE, timeout};}
+		Readiness writable(const Timestamp * timeout = nullptr) const noexcept {return {_descriptor, WRITABLE, timeout};}
+		
 		void mark() {}
 		void compact() {}
-		
+	
 	protected:
 		Descriptor _descriptor;
 	};
@@ -0,0 +1,145 @@
+//
+//  Offload.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Offload.hpp"
+#include "Defer.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <system_error>
+
+namespace Scheduler
+{
+	Offload::Offload(std::size_t concurrency) : _concurrency(concurrency ? concurrency : 1)
+	{
+	}
+	
+	Offload::~Offload()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stopping = true;
+		}
+		
+		_available.notify_all();
+		
+		for (auto & thread : _threads) {
+			thread.join();
+		}
+	}
+	
+	Offload & Offload::shared()
+	{
+		static Offload offload(std::max(4u, std::thread::hardware_concurrency()));
+		
+		return offload;
+	}
+	
+	Offload::Metrics Offload::metrics() const
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		
+		auto metrics = _metrics;
+		metrics.queued = _jobs.size();
+		metrics.threads = _threads.size();
+		
+		return metrics;
+	}
+	
+	void Offload::submit(std::shared_ptr<Job> job)
+	{
+		assert(job->reactor);
+		
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			
+			_jobs.push_back(std::move(job));
+			
+			_metrics.submitted += 1;
+			if (_jobs.size() > _metrics.max_queued) _metrics.max_queued = _jobs.size();
+			
+			// Start another thread if there are more jobs queued than threads waiting for them, and we are below the limit. Threads count as waiting until they wake up, so a burst of jobs can't all be handed to one thread:
+			if (_jobs.size() > _idle && _threads.size() < _concurrency) {
+				_threads.emplace_back(&Offload::work, this);
+			}
+		}
+		
+		_available.notify_one();
+	}
+	
+	void Offload::wait(Job & job)
+	{
+		// If we stop waiting before the completion resumes us (e.g. the deadline expires or the fiber is stopped), the completion may still be posted, but it mustn't resume us:
+		auto abandon = defer([&]{
+			job.abandoned = true;
+			
+			// If the thread is already posting the completion, it must finish before the reactor can be destroyed:
+			if (job.claimed.exchange(true)) {
+				while (!job.posted.load()) std::this_thread::yield();
+			}
+		});
+		
+		while (!job.done) {
+			if (!job.reactor->transfer())
+				throw std::system_error(ETIMEDOUT, std::generic_category(), "offload");
+		}
+		
+		abandon.cancel();
+		
+		if (job.exception) {
+			std::rethrow_exception(job.exception);
+		}
+	}
+	
+	void Offload::work()
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		while (true) {
+			_idle += 1;
+			_available.wait(lock, [&]{return _stopping || !_jobs.empty();});
+			_idle -= 1;
+			
+			if (_jobs.empty()) break;
+			
+			auto job = std::move(_jobs.front());
+			_jobs.pop_front();
+			
+			_metrics.running += 1;
+			lock.unlock();
+			
+			try {
+				job->invoke();
+			} catch (...) {
+				job->exception = std::current_exception();
+			}
+			
+			// Update the metrics before posting, so that they are consistent once the fiber resumes:
+			lock.lock();
+			_metrics.running -= 1;
+			_metrics.completed += 1;
+			lock.unlock();
+			
+			// If the fiber stopped waiting, its reactor may no longer exist:
+			if (!job->claimed.exchange(true)) {
+				// Completions which are posted before the reactor wakes up share a single wakeup:
+				job->reactor->post([job]{
+					job->done = true;
+					
+					if (!job->abandoned) job->reactor->ready(job->ready);
+				});
+				
+				job->posted = true;
+			}
+			
+			job.reset();
+			
+			lock.lock();
+		}
+	}
+}
@@ -0,0 +1,150 @@
+//
+//  Offload.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Reactor.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Scheduler
+{
+	// Runs blocking functions (e.g. file system calls, `getaddrinfo`, compression) on a pool of threads, while the calling fiber waits on its reactor. Completions are posted back to the reactor, so several completions which finish together share one wakeup.
+	class Offload final
+	{
+	public:
+		// At most `concurrency` functions run at the same time. Threads are started on demand, up to that limit.
+		Offload(std::size_t concurrency = 4);
+		
+		// Runs any functions which are still queued, and then stops the threads.
+		~Offload();
+		
+		Offload(const Offload &) = delete;
+		Offload & operator=(const Offload &) = delete;
+		
+		// A pool which is shared by the whole process, used by `Scheduler::offload`.
+		static Offload & shared();
+		
+		std::size_t concurrency() const noexcept {return _concurrency;}
+		
+		// Run the function on one of the pool's threads, and suspend the current fiber until it completes. An exception thrown by the function is rethrown in the fiber.
+		// @throws std::system_error with ETIMEDOUT if the fiber's deadline expires first. The function still runs to completion, but its result is discarded.
+		template <typename Function>
+		auto run(Function function) -> decltype(function())
+		{
+			using Result = decltype(function());
+			
+			auto invocation = std::make_shared<Invocation<Function, Result>>(std::move(function));
+			
+			submit(invocation);
+			wait(*invocation);
+			
+			if constexpr (!std::is_void<Result>::value) {
+				return std::move(*invocation->result);
+			}
+		}
+		
+		struct Metrics {
+			// The number of functions waiting for a thread, now and at most.
+			std::size_t queued = 0;
+			std::size_t max_queued = 0;
+			
+			// The number of functions running now.
+			std::size_t running = 0;
+			
+			std::size_t submitted = 0;
+			std::size_t completed = 0;
+			
+			std::size_t threads = 0;
+		};
+		
+		Metrics metrics() const;
+	
+	private:
+		// The state shared between the waiting fiber and the thread which runs the function. The fiber may stop waiting before the function completes, so it's reference counted.
+		struct Job {
+			virtual ~Job() {}
+			
+			// Invoke the function, storing the result or the exception.
+			virtual void invoke() = 0;
+			
+			Reactor * reactor = Reactor::current;
+			Reactor::Ready ready;
+			
+			std::exception_ptr exception;
+			
+			// Only accessed on the reactor's thread:
+			bool done = false;
+			bool abandoned = false;
+			
+			// Claimed by the thread before it posts the completion, or by the fiber if its deadline expires first, in which case the reactor may be destroyed before the function completes, and nothing is posted:
+			std::atomic<bool> claimed{false};
+			std::atomic<bool> posted{false};
+		};
+		
+		template <typename Function, typename Result>
+		struct Invocation : public Job {
+			Function function;
+			std::optional<Result> result;
+			
+			Invocation(Function && function_) : function(std::move(function_)) {}
+			
+			void invoke() override
+			{
+				result.emplace(function());
+			}
+		};
+		
+		template <typename Function>
+		struct Invocation<Function, void> : public Job {
+			Function function;
+			
+			Invocation(Function && function_) : function(std::move(function_)) {}
+			
+			void invoke() override
+			{
+				function();
+			}
+		};
+		
+		std::size_t _concurrency;
+		
+		mutable std::mutex _mutex;
+		std::condition_variable _available;
+		
+		std::deque<std::shared_ptr<Job>> _jobs;
+		std::vector<std::thread> _threads;
+		
+		// The number of threads waiting for a job:
+		std::size_t _idle = 0;
+		bool _stopping = false;
+		
+		Metrics _metrics;
+		
+		void submit(std::shared_ptr<Job> job);
+		void wait(Job & job);
+		
+		void work();
+	};
+	
+	// Run the function on the shared offload pool. See `Offload::run`.
+	template <typename Function>
+	auto offload(Function function) -> decltype(function())
+	{
+		return Offload::shared().run(std::move(function));
+	}
+}
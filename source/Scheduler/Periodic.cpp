@@ -0,0 +1,67 @@
+//
+//  Periodic.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Periodic.hpp"
+
+#include <cassert>
+
+namespace Scheduler
+{
+	Periodic::Periodic(Duration period, Missed missed) : _missed(missed), _registration(-1, nullptr)
+	{
+		auto timespec = period.as_timespec();
+		_period = std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(timespec.tv_sec) + std::chrono::nanoseconds(timespec.tv_nsec));
+		
+		if (_period.count() <= 0) _period = Clock::duration(1);
+		
+		reset();
+	}
+	
+	void Periodic::reset()
+	{
+		_deadline = Clock::now() + _period;
+	}
+	
+	std::size_t Periodic::wait()
+	{
+		auto now = Clock::now();
+		
+		if (now >= _deadline) {
+			// The number of deadlines which have passed, including the current one:
+			std::size_t missed = (now - _deadline) / _period + 1;
+			
+			switch (_missed) {
+				case Missed::BURST:
+					_deadline += _period;
+					return 1;
+				
+				case Missed::COALESCE:
+					_deadline += _period * missed;
+					return missed;
+				
+				case Missed::SKIP:
+					_deadline += _period * missed;
+					_skipped += missed;
+					break;
+			}
+		}
+		
+		assert(Reactor::current);
+		
+		auto remaining = std::chrono::duration<double>(_deadline - now);
+		_registration.fiber = Fiber::current;
+		
+		if (!Reactor::current->sleep(_registration, Duration(remaining.count()))) {
+			return 0;
+		}
+		
+		_deadline += _period;
+		
+		return 1;
+	}
+}
@@ -0,0 +1,60 @@
+//
+//  Periodic.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Reactor.hpp"
+
+#include <chrono>
+
+namespace Scheduler
+{
+	// Waits for ticks at a fixed period. Deadlines are computed from the start of the schedule rather than from when the previous tick was handled, so the ticks don't drift. The same timer is re-armed for every tick, so ticking doesn't allocate.
+	class Periodic final
+	{
+	public:
+		// What to do when the deadline for one or more ticks has already passed when waiting.
+		enum class Missed {
+			// Missed ticks are dropped, and the wait is for the next deadline in the future.
+			SKIP,
+			
+			// Missed ticks are delivered immediately, one per wait, until the schedule has caught up.
+			BURST,
+			
+			// Missed ticks are delivered immediately by a single wait, which returns how many there were.
+			COALESCE,
+		};
+		
+		// The first tick is one period from now.
+		Periodic(Duration period, Missed missed = Missed::SKIP);
+		
+		Periodic(const Periodic &) = delete;
+		Periodic & operator=(const Periodic &) = delete;
+		
+		// Wait for the next tick.
+		// @returns the number of ticks delivered, or 0 if the wait was interrupted.
+		std::size_t wait();
+		
+		// Restart the schedule, so that the next tick is one period from now.
+		void reset();
+		
+		// The number of ticks which were dropped by `Missed::SKIP`.
+		std::size_t skipped() const noexcept {return _skipped;}
+	
+	private:
+		using Clock = std::chrono::steady_clock;
+		
+		Clock::duration _period;
+		Missed _missed;
+		
+		Clock::time_point _deadline;
+		std::size_t _skipped = 0;
+		
+		Reactor::Registration _registration;
+	};
+}
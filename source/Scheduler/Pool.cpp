@@ -0,0 +1,278 @@
+//
+//  Pool.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Pool.hpp"
+#include "Defer.hpp"
+
+#include <cassert>
+
+namespace Scheduler
+{
+	struct Pool::Task : public Fiber {
+		Pool * pool;
+		std::function<void()> function;
+		
+		Task(Pool * pool_, std::function<void()> function_) : Fiber([this]{run();}), pool(pool_), function(std::move(function_)) {}
+		
+		void run();
+	};
+	
+	struct Pool::Worker {
+		Pool & pool;
+		std::size_t index;
+		
+		Reactor reactor;
+		Deque<Task *> runnable;
+		
+		// Whether the worker is (about to be) waiting in the selector, and needs to be woken up when work is available.
+		std::atomic<bool> parked{false};
+		
+		// Fibers which yielded or completed. They are processed after switching back to the worker, so that another thread can't resume (or delete) a fiber which is still running.
+		std::vector<Task *> yielded;
+		std::vector<Task *> finished;
+		
+		std::thread thread;
+		
+		static thread_local Worker * current;
+		
+		// A fiber can resume on a different thread, and the compiler may assume the address of a thread local is the same before and after a context switch. This ensures it is loaded again.
+		__attribute__((noinline)) static Worker * this_thread()
+		{
+			auto worker = current;
+			asm volatile("" ::: "memory");
+			return worker;
+		}
+		
+		Worker(Pool & pool_, std::size_t index_) : pool(pool_), index(index_) {}
+		
+		void run();
+		void resume(Task * task);
+		void flush();
+		void park();
+	};
+	
+	thread_local Pool::Worker * Pool::Worker::current = nullptr;
+	
+	void Pool::Task::run()
+	{
+		auto defer_finish = Defer([&]{
+			Worker::this_thread()->finished.push_back(this);
+		});
+		
+		function();
+		function = nullptr;
+	}
+	
+	void Pool::Worker::resume(Task * task)
+	{
+		task->transfer();
+		flush();
+	}
+	
+	void Pool::Worker::flush()
+	{
+		for (auto task : yielded) {
+			runnable.push(task);
+		}
+		
+		yielded.clear();
+		
+		for (auto task : finished) {
+			pool.finish(task);
+		}
+		
+		finished.clear();
+	}
+	
+	void Pool::Worker::run()
+	{
+		Reactor::current = &reactor;
+		current = this;
+		
+		while (true) {
+			// Run local work first, but keep polling the reactor so that fibers waiting on it aren't starved:
+			for (std::size_t budget = 64; budget > 0; budget -= 1) {
+				auto task = runnable.pop();
+				if (!task) break;
+				
+				resume(task);
+			}
+			
+			if (reactor.waiting()) {
+				reactor.run_once(Duration(0));
+				flush();
+			}
+			
+			if (!runnable.empty()) continue;
+			
+			if (auto task = pool.steal(*this)) {
+				resume(task);
+				continue;
+			}
+			
+			if (pool._stopping.load(std::memory_order_acquire) && !reactor.waiting()) break;
+			
+			park();
+		}
+		
+		current = nullptr;
+		Reactor::current = nullptr;
+	}
+	
+	void Pool::Worker::park()
+	{
+		// Announce that we are parking before checking for work one last time. Either a concurrent spawn sees that we are parked and wakes us up, or we see its work:
+		parked.store(true, std::memory_order_seq_cst);
+		pool._parked.fetch_add(1, std::memory_order_seq_cst);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		
+		if (!pool.available() && !pool._stopping.load(std::memory_order_acquire)) {
+			reactor.run_once(std::nullopt);
+			flush();
+		}
+		
+		// If we weren't woken up by `wake`, we must withdraw ourselves:
+		if (parked.exchange(false, std::memory_order_acq_rel)) {
+			pool._parked.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+	
+	Pool::Pool(std::size_t count)
+	{
+		if (count == 0) count = 1;
+		
+		for (std::size_t index = 0; index < count; index += 1) {
+			_workers.push_back(std::make_unique<Worker>(*this, index));
+		}
+		
+		for (auto & worker : _workers) {
+			worker->thread = std::thread(&Worker::run, worker.get());
+		}
+	}
+	
+	Pool::~Pool()
+	{
+		wait();
+		
+		_stopping.store(true, std::memory_order_release);
+		
+		for (auto & worker : _workers) {
+			worker->reactor.post([]{});
+		}
+		
+		for (auto & worker : _workers) {
+			worker->thread.join();
+		}
+	}
+	
+	void Pool::spawn(std::function<void()> function)
+	{
+		auto task = new Task(this, std::move(function));
+		
+		_outstanding.fetch_add(1, std::memory_order_relaxed);
+		
+		auto worker = Worker::this_thread();
+		
+		if (worker && &worker->pool == this) {
+			worker->runnable.push(task);
+		} else {
+			std::lock_guard<std::mutex> lock(_mutex);
+			_inbox.push_back(task);
+		}
+		
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		wake();
+	}
+	
+	void Pool::wake()
+	{
+		if (_parked.load(std::memory_order_seq_cst) == 0) return;
+		
+		for (auto & worker : _workers) {
+			if (worker->parked.exchange(false, std::memory_order_acq_rel)) {
+				_parked.fetch_sub(1, std::memory_order_relaxed);
+				
+				// Posts are only used to wake the worker up, and they collapse if it's woken more than once:
+				worker->reactor.post([]{});
+				
+				return;
+			}
+		}
+	}
+	
+	bool Pool::available()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (!_inbox.empty()) return true;
+		}
+		
+		for (auto & worker : _workers) {
+			if (!worker->runnable.empty()) return true;
+		}
+		
+		return false;
+	}
+	
+	void Pool::wait()
+	{
+		assert(Worker::this_thread() == nullptr);
+		
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		_completed.wait(lock, [&]{
+			return _outstanding.load(std::memory_order_acquire) == 0;
+		});
+	}
+	
+	void Pool::yield()
+	{
+		auto worker = Worker::this_thread();
+		assert(worker);
+		
+		worker->yielded.push_back(static_cast<Task *>(Fiber::current));
+		Fiber::main.transfer();
+	}
+	
+	Pool::Task * Pool::steal(Worker & thief)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			
+			if (!_inbox.empty()) {
+				auto task = _inbox.front();
+				_inbox.pop_front();
+				return task;
+			}
+		}
+		
+		// Start with the next worker, so that thieves don't all contend on the first one:
+		auto count = _workers.size();
+		
+		for (std::size_t offset = 1; offset < count; offset += 1) {
+			auto & victim = _workers[(thief.index + offset) % count];
+			
+			if (auto task = victim->runnable.steal()) {
+				_stolen.fetch_add(1, std::memory_order_relaxed);
+				return task;
+			}
+		}
+		
+		return nullptr;
+	}
+	
+	void Pool::finish(Task * task)
+	{
+		delete task;
+		
+		if (_outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			std::lock_guard<std::mutex> lock(_mutex);
+			_completed.notify_all();
+		}
+	}
+}
@@ -0,0 +1,83 @@
+//
+//  Pool.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Reactor.hpp"
+#include "Deque.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Scheduler
+{
+	// Runs fibers on a fixed number of threads, each with its own reactor. Runnable fibers are kept in a per-thread work stealing deque, and idle threads steal from busy ones.
+	// A fiber only migrates between threads while it is runnable. Once it waits on a reactor (e.g. for I/O or a timer), it is resumed by that reactor, on that thread.
+	// Because a fiber may resume on a different thread after `yield`, it should not cache thread local state (including `Reactor::current`) across it.
+	class Pool final
+	{
+	public:
+		Pool(std::size_t count = std::thread::hardware_concurrency());
+		
+		// Waits for all fibers to complete, and then stops the threads.
+		~Pool();
+		
+		Pool(const Pool &) = delete;
+		Pool & operator=(const Pool &) = delete;
+		
+		// The number of threads.
+		std::size_t size() const noexcept {return _workers.size();}
+		
+		// Run the function in a new fiber. If called from a fiber in the pool, it is queued on the current thread, otherwise it is queued for any thread.
+		void spawn(std::function<void()> function);
+		
+		// Wait until all fibers have completed. Must not be called from within the pool.
+		void wait();
+		
+		// The number of fibers which were stolen from another thread.
+		std::size_t stolen() const noexcept {return _stolen.load(std::memory_order_relaxed);}
+		
+		// Make the current fiber runnable again, so that other fibers (on this thread or others) can run first. Must be called from a fiber in a pool.
+		static void yield();
+	
+	private:
+		struct Task;
+		struct Worker;
+		
+		std::vector<std::unique_ptr<Worker>> _workers;
+		
+		// Fibers spawned from outside the pool:
+		std::mutex _mutex;
+		std::deque<Task *> _inbox;
+		
+		std::atomic<std::size_t> _outstanding{0};
+		std::condition_variable _completed;
+		
+		// The number of workers which are waiting for events because they have no work:
+		std::atomic<std::size_t> _parked{0};
+		
+		std::atomic<bool> _stopping{false};
+		std::atomic<std::size_t> _stolen{0};
+		
+		Task * steal(Worker & thief);
+		
+		// Wake up one parked worker, if any, so that it can take new work.
+		void wake();
+		
+		// Whether there is any work which could be stolen.
+		bool available();
+		
+		void finish(Task * task);
+	};
+}
@@ -0,0 +1,184 @@
+//
+//  Process.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Process.hpp"
+#include "Monitor.hpp"
+
+#include <cassert>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <spawn.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <system_error>
+
+#if defined(SCHEDULER_EPOLL)
+	#include <sys/syscall.h>
+#endif
+
+extern char ** environ;
+
+namespace Scheduler
+{
+	namespace
+	{
+		// A pipe connected to one of the child's standard descriptors.
+		struct Redirection
+		{
+			Handle child, parent;
+			
+			// If `input`, the child reads from the pipe, otherwise it writes to it.
+			Redirection(bool input)
+			{
+				Descriptor descriptors[2];
+				
+				// Neither end should leak into other children, and dup2 clears the flag on the child's copy:
+#if defined(_GNU_SOURCE)
+				auto result = ::pipe2(descriptors, O_CLOEXEC);
+#else
+				auto result = ::pipe(descriptors);
+#endif
+				
+				if (result == -1)
+					throw std::system_error(errno, std::generic_category(), "pipe");
+				
+				child = descriptors[input ? 0 : 1];
+				parent = descriptors[input ? 1 : 0];
+
+#if !defined(_GNU_SOURCE)
+				::fcntl(child, F_SETFD, FD_CLOEXEC);
+				::fcntl(parent, F_SETFD, FD_CLOEXEC);
+#endif
+				
+				update_flags(parent, O_NONBLOCK);
+			}
+		};
+	}
+	
+	static Handle open_process(pid_t pid)
+	{
+#if defined(SCHEDULER_EPOLL)
+		Handle handle(::syscall(SYS_pidfd_open, pid, 0));
+		
+		if (!handle)
+			throw std::system_error(errno, std::generic_category(), "pidfd_open");
+#elif defined(SCHEDULER_KQUEUE)
+		// A kqueue of its own, which becomes readable when the process exits:
+		Handle handle(::kqueue());
+		
+		if (!handle)
+			throw std::system_error(errno, std::generic_category(), "kqueue");
+		
+		struct kevent change;
+		EV_SET(&change, pid, EVFILT_PROC, EV_ADD, NOTE_EXIT, 0, nullptr);
+		
+		if (::kevent(handle, &change, 1, nullptr, 0, nullptr) == -1) {
+			// Some kernels refuse to watch a process which has already exited, in which case it can be reaped without waiting:
+			if (errno == ESRCH) return Handle();
+			
+			throw std::system_error(errno, std::generic_category(), "kevent");
+		}
+#endif
+		
+		return handle;
+	}
+	
+	Process::Process(const std::vector<std::string> & arguments, Stdio stdio)
+	{
+		assert(!arguments.empty());
+		
+		std::vector<char *> argv;
+		for (auto & argument : arguments) {
+			argv.push_back(const_cast<char *>(argument.c_str()));
+		}
+		argv.push_back(nullptr);
+		
+		posix_spawn_file_actions_t actions;
+		posix_spawn_file_actions_init(&actions);
+		
+		std::optional<Redirection> pipes[3];
+		
+		if (stdio == PIPE) {
+			for (int descriptor = 0; descriptor < 3; descriptor += 1) {
+				auto & pipe = pipes[descriptor].emplace(descriptor == 0);
+				posix_spawn_file_actions_adddup2(&actions, pipe.child, descriptor);
+			}
+		}
+		
+		auto result = ::posix_spawnp(&_pid, argv[0], &actions, nullptr, argv.data(), environ);
+		posix_spawn_file_actions_destroy(&actions);
+		
+		if (result != 0)
+			throw std::system_error(result, std::generic_category(), "posix_spawnp");
+		
+		// The child can't be reaped by anyone else until we wait for it, so its pid can't be reused in the meantime:
+		try {
+			_handle = open_process(_pid);
+		} catch (...) {
+			::kill(_pid, SIGKILL);
+			::waitpid(_pid, nullptr, 0);
+			
+			throw;
+		}
+		
+		if (stdio == PIPE) {
+			input = std::move(pipes[0]->parent);
+			output = std::move(pipes[1]->parent);
+			error = std::move(pipes[2]->parent);
+		}
+	}
+	
+	Process::~Process()
+	{
+		if (!_status) {
+			::kill(_pid, SIGKILL);
+			::waitpid(_pid, nullptr, 0);
+		}
+	}
+	
+	void Process::kill(int signal)
+	{
+		if (_status) return;
+		
+		if (::kill(_pid, signal) == -1)
+			throw std::system_error(errno, std::generic_category(), "kill");
+	}
+	
+	std::optional<int> Process::wait(const Timestamp * timeout)
+	{
+		while (!_status) {
+			int status = 0;
+			
+			// Without a handle, the child has already exited, so this doesn't block:
+			auto result = ::waitpid(_pid, &status, _handle ? WNOHANG : 0);
+			
+			if (result == -1) {
+				if (errno == EINTR) continue;
+				
+				throw std::system_error(errno, std::generic_category(), "waitpid");
+			}
+			
+			if (result == _pid) {
+				_status = status;
+				_handle.close();
+				
+				break;
+			}
+			
+			assert(Reactor::current);
+			
+			if (Reactor::current->wait(_handle, Monitor::READABLE, timeout) == 0) {
+				return std::nullopt;
+			}
+		}
+		
+		return _status;
+	}
+}
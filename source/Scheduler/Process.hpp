@@ -0,0 +1,66 @@
+//
+//  Process.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Reactor.hpp"
+#include "Handle.hpp"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+namespace Scheduler
+{
+	// A child process, which is spawned with `posix_spawnp` and monitored through a descriptor: a pidfd on Linux, or a kqueue with EVFILT_PROC elsewhere. Waiting for it to exit suspends the current fiber until the descriptor becomes readable, so it costs one wakeup, and doesn't need SIGCHLD.
+	class Process final
+	{
+	public:
+		// Whether the child's standard input, output and error are connected to pipes.
+		enum Stdio {
+			// The child inherits the parent's standard input, output and error.
+			INHERIT,
+			
+			// Connect them to pipes, whose parent ends are non-blocking, so they can be used with `Monitor` or `IO`.
+			PIPE,
+		};
+		
+		// Spawn the executable named by the first argument, which is searched for in PATH.
+		// @throws std::system_error if the process can't be spawned.
+		Process(const std::vector<std::string> & arguments, Stdio stdio = INHERIT);
+		
+		// If the child has not been reaped, it is killed and reaped.
+		~Process();
+		
+		Process(const Process &) = delete;
+		Process & operator=(const Process &) = delete;
+		
+		pid_t pid() const noexcept {return _pid;}
+		
+		// Readable once the child exits. It's closed once the child is reaped, and may be closed from the start if the child exited before it could be watched.
+		const Handle & handle() const noexcept {return _handle;}
+		
+		// Send a signal to the child, unless it has been reaped.
+		void kill(int signal);
+		
+		// Wait for the child to exit, and reap it.
+		// @returns the status, as reported by `waitpid`, or nothing if the timeout (or the fiber's deadline) expired.
+		std::optional<int> wait(const Timestamp * timeout = nullptr);
+		
+		// The parent ends of the pipes, if the child was spawned with `PIPE`. Writing to `input` is read from the child's standard input, and so on.
+		Handle input, output, error;
+	
+	private:
+		pid_t _pid = -1;
+		Handle _handle;
+		
+		std::optional<int> _status;
+	};
+}
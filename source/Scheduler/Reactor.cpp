@@ -7,15 +7,37 @@
 //
 
 #include "Reactor.hpp"
+#include "Deadline.hpp"
 
 #include <Time/Timeout.hpp>
 #include <Concurrent/Fiber.hpp>
 
 #include <errno.h>
+#include <cassert>
 #include <system_error>
 #include <iostream>
 
 #include <unistd.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <memory>
+
+#if defined(SCHEDULER_EPOLL)
+	#include <sys/eventfd.h>
+	#include <sys/ioctl.h>
+	
+	// The epoll busy poll parameters were added in Linux 6.9, and older headers don't declare them:
+	#if !defined(EPIOCSPARAMS)
+		struct epoll_params {
+			std::uint32_t busy_poll_usecs;
+			std::uint16_t busy_poll_budget;
+			std::uint8_t prefer_busy_poll;
+			std::uint8_t __pad;
+		};
+		
+		#define EPIOCSPARAMS _IOW(0x8A, 0x01, struct epoll_params)
+	#endif
+#endif
 
 namespace Scheduler
 {
@@ -25,13 +47,9 @@ namespace Scheduler
 	
 	thread_local Reactor * Reactor::current = nullptr;
 	
-	void Reactor::Registration::schedule(Timers & timers, const Timestamp & timeout)
+	void Reactor::Registration::schedule(Reactor & reactor, const Timestamp & timeout, const Duration & slack)
 	{
-		if (timeout_event) {
-			timeout_event->handle.cancel();
-		}
-		
-		timeout_event = timers.schedule(timeout, TimeoutHandle{this});
+		reactor._timers.reschedule(timeout_event, timeout, TimeoutHandle{&reactor, this}, slack);
 	}
 	
 	std::size_t Reactor::run()
@@ -76,8 +94,134 @@ namespace Scheduler
 		return count;
 	}
 	
+	std::size_t Reactor::run_once(const std::optional<Duration> & duration)
+	{
+		std::size_t count = 0;
+		
+		count += transfer_ready();
+		
+		auto remaining = duration;
+		
+		auto next_timer = transfer_timers();
+		if (next_timer) {
+			auto duration = Duration(*next_timer);
+			if (!remaining || duration < *remaining) remaining = duration;
+		}
+		
+		if (remaining)
+			count += select(*remaining);
+		else
+			count += select();
+		
+		count += transfer_ready();
+		
+		return count;
+	}
+	
 	Reactor::~Reactor()
 	{
+		// Callables which were posted but never invoked are discarded:
+		while (auto posted = pop()) {
+			delete posted;
+		}
+	}
+	
+	void Reactor::push(Posted * posted)
+	{
+		posted->next.store(nullptr, std::memory_order_relaxed);
+		
+		auto previous = _head.exchange(posted, std::memory_order_acq_rel);
+		
+		// Until this store, the consumer can't see the posted callable (or any that are pushed after it):
+		previous->next.store(posted, std::memory_order_release);
+	}
+	
+	Reactor::Posted * Reactor::pop()
+	{
+		auto tail = _tail;
+		auto next = tail->next.load(std::memory_order_acquire);
+		
+		if (tail == &_stub) {
+			if (next == nullptr) return nullptr;
+			
+			_tail = next;
+			tail = next;
+			next = next->next.load(std::memory_order_acquire);
+		}
+		
+		if (next) {
+			_tail = next;
+			return tail;
+		}
+		
+		// A producer is part way through pushing, it will notify us again when it's done:
+		if (tail != _head.load(std::memory_order_acquire)) return nullptr;
+		
+		// The tail is the last item, so put the stub behind it before taking it:
+		push(&_stub);
+		
+		next = tail->next.load(std::memory_order_acquire);
+		
+		if (next) {
+			_tail = next;
+			return tail;
+		}
+		
+		return nullptr;
+	}
+	
+	void Reactor::post(std::function<void()> callable)
+	{
+		push(new Posted{{nullptr}, std::move(callable)});
+		
+		if (!_notified.exchange(true, std::memory_order_acq_rel)) {
+			notify();
+		}
+	}
+	
+	// A fiber resumed from another thread, which doesn't have a node of its own to add to the ready list:
+	struct Resumption : public Reactor::Ready {
+		Fiber * target;
+		
+		Resumption(Fiber * target_, Reactor::Priority priority) : Ready(nullptr, priority), target(target_)
+		{
+			callback = &Resumption::resume;
+			context = this;
+		}
+		
+		static void resume(void * context)
+		{
+			auto resumption = static_cast<Resumption *>(context);
+			auto fiber = resumption->target;
+			
+			delete resumption;
+			fiber->transfer();
+		}
+	};
+	
+	void Reactor::resume(Fiber * fiber, Priority priority)
+	{
+		// Posted callables are invoked while dispatching events, so the fiber is added to the ready list, rather than being resumed ahead of everything else:
+		post([this, fiber, priority]{
+			ready(*new Resumption(fiber, priority));
+		});
+	}
+	
+	std::size_t Reactor::transfer_posted()
+	{
+		// Clear the flag before consuming, so that anything posted after this point will notify us again:
+		_notified.store(false, std::memory_order_seq_cst);
+		
+		std::size_t count = 0;
+		
+		while (auto posted = pop()) {
+			std::unique_ptr<Posted> owner(posted);
+			
+			count += 1;
+			posted->callable();
+		}
+		
+		return count;
 	}
 	
 	struct Blocking
@@ -96,10 +240,156 @@ namespace Scheduler
 		}
 	};
 	
-	void Reactor::transfer()
+	void Reactor::set_metrics(bool enabled)
+	{
+		if (enabled) {
+			_metrics = std::make_unique<Metrics>();
+			_timers.set_lateness(&_metrics->timer_lateness);
+		} else {
+			_timers.set_lateness(nullptr);
+			_metrics.reset();
+		}
+		
+		_selected = {};
+	}
+	
+	Reactor::Metrics Reactor::metrics() const
+	{
+		Metrics metrics;
+		if (_metrics) metrics = *_metrics;
+		
+		metrics.event_capacity = _events.capacity();
+		
+		return metrics;
+	}
+	
+	void Reactor::reset_metrics()
+	{
+		if (_metrics) {
+			*_metrics = Metrics();
+			_selected = {};
+		}
+	}
+	
+	void Reactor::record_selecting()
+	{
+		_selecting = std::chrono::steady_clock::now();
+		
+		if (_selected.time_since_epoch().count()) {
+			_metrics->run_time += std::chrono::duration_cast<std::chrono::nanoseconds>(_selecting - _selected).count();
+		}
+	}
+	
+	void Reactor::record_selected(std::size_t events)
 	{
+		_selected = std::chrono::steady_clock::now();
+		
+		_metrics->iterations += 1;
+		_metrics->select_time += std::chrono::duration_cast<std::chrono::nanoseconds>(_selected - _selecting).count();
+		
+		_metrics->events += events;
+		if (events > _metrics->max_events) _metrics->max_events = events;
+	}
+	
+	void Reactor::set_busy_poll(const Duration & limit)
+	{
+		auto timespec = limit.as_timespec();
+		
+		_busy_poll = BusyPoll();
+		_busy_poll.limit = std::uint64_t(timespec.tv_sec) * 1000000000 + timespec.tv_nsec;
+		_busy_poll.budget = _busy_poll.limit;
+	}
+	
+	std::size_t Reactor::spin(struct timespec * timeout)
+	{
+		using namespace std::chrono;
+		
+		auto budget = nanoseconds(_busy_poll.budget);
+		
+		if (timeout) {
+			auto remaining = seconds(timeout->tv_sec) + nanoseconds(timeout->tv_nsec);
+			if (remaining < budget) budget = remaining;
+		}
+		
+		if (budget.count() <= 0) return 0;
+		
+		struct timespec zero = {0, 0};
+		std::size_t count = 0;
+		
+		auto start = steady_clock::now(), now = start;
+		auto deadline = start + budget;
+		
+		do {
+			count = select_internal(&zero);
+			now = steady_clock::now();
+		} while (count == 0 && now < deadline);
+		
+		auto elapsed = duration_cast<nanoseconds>(now - start);
+		
+		_busy_poll.spins += 1;
+		_busy_poll.time += elapsed.count();
+		
+		// Grow the budget quickly while spinning finds events, and shrink it when it doesn't, but never below a fraction of the limit, so that it can recover:
+		if (count) {
+			_busy_poll.hits += 1;
+			_busy_poll.events += count;
+			_busy_poll.budget = std::min(_busy_poll.limit, _busy_poll.budget * 2);
+		} else {
+			_busy_poll.budget = std::max(_busy_poll.limit / 16, _busy_poll.budget / 2);
+		}
+		
+		if (count == 0 && timeout) {
+			auto remaining = seconds(timeout->tv_sec) + nanoseconds(timeout->tv_nsec) - elapsed;
+			if (remaining.count() < 0) remaining = nanoseconds(0);
+			
+			timeout->tv_sec = duration_cast<seconds>(remaining).count();
+			timeout->tv_nsec = (remaining - seconds(timeout->tv_sec)).count();
+		}
+		
+		return count;
+	}
+	
+	bool Reactor::transfer()
+	{
+		auto deadline = _deadline ? _deadline->_effective : nullptr;
+		
+		if (deadline && deadline->expired()) return false;
+		
+		if (_metrics) {
+			_metrics->waits += 1;
+			if (_waits) *_waits += 1;
+		}
+		
 		Blocking blocking(_waiting);
+		
+		// The reactor runs at normal priority without a deadline, and we restore our own state when we are resumed:
+		auto priority = _priority;
+		auto scope = _deadline;
+		auto waits = _waits;
+		
+		_priority = Priority::NORMAL;
+		_deadline = nullptr;
+		_waits = nullptr;
+		
+		if (deadline) deadline->_registration.fiber = Fiber::current;
+		
 		Fiber::main.transfer();
+		
+		_priority = priority;
+		_deadline = scope;
+		_waits = waits;
+		
+		if (deadline) {
+			auto & registration = deadline->_registration;
+			
+			// We may have been resumed by something else after the deadline made us ready:
+			registration.fiber = nullptr;
+			if (registration.linked()) registration.unlink();
+			
+			return !deadline->expired();
+		}
+		
+		return true;
 	}
 	
 	// Transfer from the current fiber to the specified fiber.
@@ -107,19 +397,54 @@ namespace Scheduler
 	void Reactor::transfer(Fiber * fiber)
 	{
 		Blocking blocking(_waiting);
-		auto iterator = _ready.insert(_ready.end(), Fiber::current);
 		
-		auto deferred = Defer([this, iterator]{
-			_ready.erase(iterator);
-		});
+		Ready ready(Fiber::current, _priority);
+		this->ready(ready);
+		
+		// The fiber has its own deadline and wait counter, if any:
+		auto scope = _deadline;
+		auto waits = _waits;
+		
+		_deadline = nullptr;
+		_waits = nullptr;
 		
 		fiber->transfer();
+		
+		_priority = ready.priority;
+		_deadline = scope;
+		_waits = waits;
+	}
+	
+	void Reactor::spawn(std::function<void()> function, std::size_t stack_size)
+	{
+		auto fiber = _fibers.acquire(std::move(function), stack_size);
+		
+		if (Fiber::current == &Fiber::main) {
+			_priority = Priority::NORMAL;
+			fiber->transfer();
+		}
+		else {
+			transfer(fiber);
+		}
 	}
 	
-	bool Reactor::sleep(Fiber * fiber, const Timestamp & until)
+	bool Reactor::sleep(Fiber * fiber, const Timestamp & until, const Duration * slack)
 	{
 		Registration registration(-1, fiber);
-		registration.schedule(_timers, until);
+		
+		return sleep(registration, until, slack);
+	}
+	
+	bool Reactor::sleep(Registration & registration, const Timestamp & until, const Duration * slack)
+	{
+		registration.result = -1;
+		registration.priority = _priority;
+		registration.schedule(*this, until, slack ? *slack : _slack);
+		
+		// If the sleep is interrupted, the timer must not fire later:
+		auto defer_cancel = defer([&]{
+			registration.timeout_event.cancel();
+		});
 		
 		transfer();
 		
@@ -132,19 +457,66 @@ namespace Scheduler
 	{
 		size_t count = 0;
 		
-		while (!_ready.empty()) {
-			auto fiber = _ready.front();
-			
+		while (auto ready = next_ready()) {
 			count += 1;
-			fiber->transfer();
+			
+			if (ready->callback) {
+				ready->callback(ready->context);
+			} else {
+				ready->fiber->transfer();
+			}
+		}
+		
+		if (_metrics && count) {
+			_metrics->ready += count;
+			if (count > _metrics->max_ready) _metrics->max_ready = count;
 		}
 		
 		return count;
 	}
 	
+	Reactor::Ready * Reactor::next_ready()
+	{
+		// A class which has been passed over too many times goes first, starting with the lowest priority:
+		for (std::size_t priority = PRIORITIES; priority-- > 1;) {
+			if (_bypassed[priority] >= _starvation_limit && !_ready[priority].empty()) {
+				_bypassed[priority] = 0;
+				
+				return _ready[priority].pop_front();
+			}
+		}
+		
+		for (std::size_t priority = 0; priority < PRIORITIES; priority += 1) {
+			if (auto ready = _ready[priority].pop_front()) {
+				_bypassed[priority] = 0;
+				
+				for (auto lower = priority + 1; lower < PRIORITIES; lower += 1) {
+					if (!_ready[lower].empty()) _bypassed[lower] += 1;
+				}
+				
+				return ready;
+			}
+		}
+		
+		return nullptr;
+	}
+	
+	bool Reactor::runnable() const noexcept
+	{
+		for (auto & ready : _ready) {
+			if (!ready.empty()) return true;
+		}
+		
+		return false;
+	}
+	
 	std::optional<Timestamp> Reactor::transfer_timers()
 	{
 		_timers.run();
+		
+		// Fibers which were made ready (e.g. by timers) must be resumed without blocking:
+		if (runnable()) return Duration(0);
+		
 		return _timers.next_timestamp();
 	}
 	
@@ -158,10 +530,237 @@ namespace Scheduler
 			return select();
 	}
 	
+	Reactor::Waiters & Reactor::waiters(Descriptor descriptor)
+	{
+		assert(descriptor >= 0);
+		
+		if (std::size_t(descriptor) >= _descriptors.size()) {
+			_descriptors.resize(descriptor + 1);
+		}
+		
+		return _descriptors[descriptor];
+	}
+	
+	void Reactor::identify(Descriptor descriptor, Waiters & waiters)
+	{
+		struct stat status;
+		
+		if (::fstat(descriptor, &status) == 0) {
+			waiters.device = status.st_dev;
+			waiters.inode = status.st_ino;
+		}
+	}
+	
+	bool Reactor::registered(Descriptor descriptor, const Waiters & waiters)
+	{
+		struct stat status;
+		
+		if (::fstat(descriptor, &status) == -1) return false;
+		
+		return status.st_dev == waiters.device && status.st_ino == waiters.inode;
+	}
+	
+	int Reactor::wait(Descriptor descriptor, int events, const Timestamp * timeout)
+	{
+		Registration registration;
+		
+		if (auto ready = watch(descriptor, events, registration)) {
+			return ready;
+		}
+		
+		auto defer_removal = defer([&]{
+			unwatch(descriptor, registration);
+		});
+		
+		if (timeout) {
+			registration.schedule(*this, *timeout, _slack);
+		}
+		
+		transfer();
+		
+		return registration.result;
+	}
+	
+	int Reactor::watch(Descriptor descriptor, int events, Registration & registration)
+	{
+		auto directions = Reactor::directions(events);
+		auto & waiters = this->waiters(descriptor);
+		
+		// If the descriptor became ready while nothing was waiting, the edge has already been consumed by the selector, so we must not block:
+		if (waiters.ready & directions) {
+			waiters.ready &= ~directions;
+			return events;
+		}
+		
+		// The registration is persistent, so if the descriptor was closed without being forgotten and its number was reused, the selector isn't monitoring the new file:
+		if (waiters.interest && !waiters.reader && !waiters.writer && !registered(descriptor, waiters)) {
+			forget(descriptor);
+		}
+		
+		if ((directions & Waiters::READ) && waiters.reader)
+			throw std::system_error(EBUSY, std::generic_category(), "descriptor already has a reader");
+		
+		if ((directions & Waiters::WRITE) && waiters.writer)
+			throw std::system_error(EBUSY, std::generic_category(), "descriptor already has a writer");
+		
+		// The selector only needs to be updated when the interest set grows:
+		if ((waiters.interest & directions) != directions) {
+			if (waiters.interest == 0) identify(descriptor, waiters);
+			
+			update(descriptor, waiters.interest, waiters.interest | directions);
+			waiters.interest |= directions;
+		}
+		
+		if (directions & Waiters::READ) waiters.reader = &registration;
+		if (directions & Waiters::WRITE) waiters.writer = &registration;
+
+#if defined(SCHEDULER_URING)
+		if (_ring && !_multishot && (waiters.armed & directions) != directions) {
+			rearm(descriptor, waiters.armed | directions);
+		}
+#endif
+		
+		return 0;
+	}
+	
+	void Reactor::unwatch(Descriptor descriptor, Registration & registration)
+	{
+		// The descriptor table may have been resized or forgotten while we were waiting, so we can't hold on to the waiters:
+		if (std::size_t(descriptor) < _descriptors.size()) {
+			auto & waiters = _descriptors[descriptor];
+			
+			if (waiters.reader == &registration) waiters.reader = nullptr;
+			if (waiters.writer == &registration) waiters.writer = nullptr;
+		}
+	}
+	
+	void Reactor::dispatch(Descriptor descriptor, int directions, int result)
+	{
+		if (std::size_t(descriptor) >= _descriptors.size()) return;
+
 #if defined(SCHEDULER_EPOLL)
-	Reactor::Reactor() : _selector(::epoll_create1(EPOLL_CLOEXEC))
+		if (descriptor == _wakeup) {
+			std::uint64_t value;
+			while (::read(_wakeup, &value, sizeof(value)) == -1 && errno == EINTR);
+			
+			transfer_posted();
+			
+			return;
+		}
+#endif
+		
+		if (directions & Waiters::READ) {
+			auto & waiters = _descriptors[descriptor];
+			
+			if (auto registration = waiters.reader) {
+				waiters.reader = nullptr;
+				
+				// A registration waiting in both directions is only resumed once:
+				if (waiters.writer == registration) {
+					waiters.writer = nullptr;
+					directions &= ~Waiters::WRITE;
+				}
+				
+				registration->result = result;
+				wake(*registration);
+			} else {
+				waiters.ready |= Waiters::READ;
+			}
+		}
+		
+		if (directions & Waiters::WRITE) {
+			auto & waiters = _descriptors[descriptor];
+			
+			if (auto registration = waiters.writer) {
+				waiters.writer = nullptr;
+				
+				registration->result = result;
+				wake(*registration);
+			} else {
+				waiters.ready |= Waiters::WRITE;
+			}
+		}
+	}
+	
+	void Reactor::forget(Descriptor descriptor)
+	{
+		if (descriptor < 0 || std::size_t(descriptor) >= _descriptors.size()) return;
+		
+		auto & waiters = _descriptors[descriptor];
+		
+		if (waiters.interest) {
+			update(descriptor, waiters.interest, 0);
+		}
+		
+		auto generation = waiters.generation + 1;
+		waiters = Waiters();
+		waiters.generation = generation;
+	}
+	
+	void Reactor::exclusive(Descriptor descriptor)
 	{
+		auto & waiters = this->waiters(descriptor);
+		
+		if (waiters.interest) return;
+
+#if defined(SCHEDULER_URING)
+		if (_ring) return;
+#endif
+
+#if defined(SCHEDULER_EPOLL)
+		struct epoll_event event = {};
+		event.events = EPOLLIN | EPOLLET | EPOLLEXCLUSIVE;
+		event.data.fd = descriptor;
+		
+		// Exclusive registrations can't be modified, so the interest set is fixed from now on:
+		if (::epoll_ctl(_selector, EPOLL_CTL_ADD, descriptor, &event) == -1)
+			throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+		
+		identify(descriptor, waiters);
+		waiters.interest = Waiters::READ;
+#endif
+	}
+
+#if defined(SCHEDULER_EPOLL)
+	Reactor::Reactor(const Duration & resolution) : _timers(resolution)
+	{
+#if defined(SCHEDULER_URING)
+		try {
+			_ring = std::make_unique<Ring>(256);
+			_operations.resize(1);
+			
+			register_wakeup();
+			
+			return;
+		} catch (const std::system_error &) {
+			// The kernel is too old, or io_uring has been disabled, so fall back to epoll.
+		}
+#endif
+		
+		_selector = Handle(::epoll_create1(EPOLL_CLOEXEC));
 		_events.reserve(512);
+		
+		register_wakeup();
+	}
+	
+	void Reactor::register_wakeup()
+	{
+		_wakeup = Handle(::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK));
+		
+		if (_wakeup == -1)
+			throw std::system_error(errno, std::generic_category(), "eventfd");
+		
+		update(_wakeup, 0, Waiters::READ);
+		waiters(_wakeup).interest = Waiters::READ;
+	}
+	
+	void Reactor::notify()
+	{
+		std::uint64_t value = 1;
+		
+		// If the counter would overflow, the reactor has a wakeup pending anyway:
+		if (::write(_wakeup, &value, sizeof(value)) == -1 && errno != EAGAIN)
+			throw std::system_error(errno, std::generic_category(), "write");
 	}
 	
 	std::size_t Reactor::select()
@@ -181,8 +780,19 @@ namespace Scheduler
 	
 	std::size_t Reactor::select_internal(struct timespec * timeout)
 	{
+		if (_busy_poll.limit && !(timeout && timeout->tv_sec == 0 && timeout->tv_nsec == 0)) {
+			if (auto count = spin(timeout)) return count;
+		}
+
+#if defined(SCHEDULER_URING)
+		if (_ring) return select_ring(timeout);
+#endif
+		
 		_events.resize(_events.capacity());
+		
+		selecting();
 		auto result = ::epoll_pwait2(_selector, _events.data(), _events.size(), timeout, nullptr);
+		selected(result > 0 ? result : 0);
 		
 		// If we are interrupted, return gracefully.
 		if (result == -1 && errno == EINTR)
@@ -194,11 +804,7 @@ namespace Scheduler
 		_events.resize(result);
 		
 		for (auto & event : _events) {
-			auto registration = reinterpret_cast<Registration*>(event.data.ptr);
-			registration->result = event.events;
-			
-			auto fiber = registration->fiber;
-			if (fiber != nullptr) fiber->transfer();
+			dispatch(event.data.fd, directions(event.events), event.events);
 		}
 		
 		_events.resize(0);
@@ -206,36 +812,295 @@ namespace Scheduler
 		// If we received the maximum number of events, increase the size of the event buffer.
 		if (std::size_t(result) == _events.capacity()) {
 			_events.reserve(_events.capacity() * 2);
+			
+			if (_metrics) _metrics->event_growths += 1;
 		}
 		
 		return result;
 	}
 	
-	void Reactor::append(int operation, Descriptor descriptor, int events, Registration * registration, const Timestamp * timeout)
+	bool Reactor::set_kernel_busy_poll(std::uint32_t microseconds, std::uint16_t budget, bool prefer)
 	{
-		assert(!registration || registration->fiber);
+#if defined(SCHEDULER_URING)
+		// Completions don't go through epoll:
+		if (_ring) return false;
+#endif
 		
-		struct epoll_event event;
-		event.events = events;
+		struct epoll_params parameters = {};
+		parameters.busy_poll_usecs = microseconds;
+		parameters.busy_poll_budget = budget;
+		parameters.prefer_busy_poll = prefer;
+		
+		if (::ioctl(_selector, EPIOCSPARAMS, &parameters) == -1) {
+			// The kernel is too old:
+			if (errno == ENOTTY) return false;
+			
+			throw std::system_error(errno, std::generic_category(), "ioctl(EPIOCSPARAMS)");
+		}
+		
+		return true;
+	}
+	
+	int Reactor::directions(int events)
+	{
+		int directions = 0;
+		
+		if (events & (EPOLLIN | EPOLLHUP | EPOLLERR)) directions |= Waiters::READ;
+		if (events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) directions |= Waiters::WRITE;
+		
+		return directions;
+	}
+	
+	void Reactor::update(Descriptor descriptor, int interest, int directions)
+	{
+#if defined(SCHEDULER_URING)
+		if (_ring) {
+			// Registrations are only submitted by the next select, so that they are batched together:
+			if (interest) {
+				auto entry = _ring->submission();
+				entry->opcode = IORING_OP_POLL_REMOVE;
+				entry->fd = -1;
+				entry->addr = poll_data(descriptor);
+			}
+			
+			if (directions) {
+				arm(descriptor, directions);
+			} else {
+				// The descriptor is about to be closed, so the removal can't be deferred:
+				_ring->enter();
+			}
+			
+			return;
+		}
+#endif
+		
+		struct epoll_event event = {};
+		event.events = EPOLLET;
 		event.data.fd = descriptor;
-		event.data.ptr = registration;
+		
+		if (directions & Waiters::READ) event.events |= EPOLLIN;
+		if (directions & Waiters::WRITE) event.events |= EPOLLOUT;
+		
+		int operation = EPOLL_CTL_MOD;
+		
+		if (directions == 0)
+			operation = EPOLL_CTL_DEL;
+		else if (interest == 0)
+			operation = EPOLL_CTL_ADD;
 		
 		auto result = ::epoll_ctl(_selector, operation, descriptor, &event);
 		
+		if (operation == EPOLL_CTL_DEL) {
+			// The descriptor may already have been closed, which removes it from the selector.
+			return;
+		}
+		
+		// If the descriptor was closed and reused without being forgotten, the registration will be out of sync with the table:
+		if (result == -1 && errno == ENOENT) {
+			result = ::epoll_ctl(_selector, EPOLL_CTL_ADD, descriptor, &event);
+		} else if (result == -1 && errno == EEXIST) {
+			result = ::epoll_ctl(_selector, EPOLL_CTL_MOD, descriptor, &event);
+		}
+		
 		if (result == -1) {
 			throw std::system_error(errno, std::generic_category(), "epoll_ctl");
 		}
+	}
+
+#if defined(SCHEDULER_URING)
+	void Reactor::arm(Descriptor descriptor, int directions)
+	{
+		std::uint32_t events = 0;
 		
-		if (timeout) {
-			assert(registration);
-			registration->schedule(_timers, *timeout);
+		if (directions & Waiters::READ) events |= EPOLLIN;
+		if (directions & Waiters::WRITE) events |= EPOLLOUT;
+
+#if __BYTE_ORDER == __BIG_ENDIAN
+		events = (events << 16) | (events >> 16);
+#endif
+		
+		auto entry = _ring->submission();
+		entry->opcode = IORING_OP_POLL_ADD;
+		entry->fd = descriptor;
+		entry->poll32_events = events;
+		entry->user_data = poll_data(descriptor);
+		
+		if (_multishot) entry->len = IORING_POLL_ADD_MULTI;
+		else this->waiters(descriptor).armed = directions;
+	}
+	
+	void Reactor::rearm(Descriptor descriptor, int directions)
+	{
+		// Replace the pending poll, if any:
+		if (_descriptors[descriptor].armed) {
+			auto entry = _ring->submission();
+			entry->opcode = IORING_OP_POLL_REMOVE;
+			entry->fd = -1;
+			entry->addr = poll_data(descriptor);
+		}
+		
+		arm(descriptor, directions);
+	}
+	
+	std::size_t Reactor::select_ring(struct timespec * timeout)
+	{
+		bool poll = timeout && timeout->tv_sec == 0 && timeout->tv_nsec == 0;
+		
+		// Submit every registration made since the last iteration, and wait for completions, in one system call:
+		selecting();
+		_ring->enter(poll ? 0 : 1, timeout);
+		
+		if (_metrics) selected(_ring->available());
+		
+		return _ring->complete([&](std::uint64_t user_data, int result, unsigned flags){
+			if (user_data == 0) return;
+			
+			if (!(user_data & POLL)) {
+				auto index = user_data >> 1;
+				auto operation = _operations[index];
+				
+				_operations[index] = nullptr;
+				_available.push_back(index);
+				
+				// The operation may have been abandoned:
+				if (operation) {
+					operation->completed = true;
+					operation->registration.result = result;
+					ready(operation->registration);
+				}
+				
+				return;
+			}
+			
+			Descriptor descriptor = (user_data & 0xFFFFFFFF) >> 1;
+			
+			// Kernels without multishot poll reject the flag:
+			if (result == -EINVAL && _multishot) {
+				_multishot = false;
+			}
+			
+			// The poll was for a file which has since been forgotten:
+			if (std::size_t(descriptor) < _descriptors.size() && (user_data >> 32) != _descriptors[descriptor].generation) {
+				return;
+			}
+			
+			// The poll has finished but the descriptor is still registered, e.g. it was not multishot:
+			bool finished = !(flags & IORING_CQE_F_MORE) && result != -ECANCELED && result != -EBADF && std::size_t(descriptor) < _descriptors.size();
+			
+			if (finished) {
+				auto & waiters = _descriptors[descriptor];
+				waiters.armed = 0;
+				
+				if (_multishot && waiters.interest) {
+					arm(descriptor, waiters.interest);
+				}
+			}
+			
+			if (result > 0) {
+				dispatch(descriptor, directions(result), result);
+			}
+			
+			// A one-shot poll is only re-armed for directions which are still waiting, otherwise a descriptor which stays ready would complete it again immediately. Waiters which were resumed re-arm it from `watch` if they need to wait again. The wakeup descriptor was drained by `dispatch`, so it's always re-armed:
+			if (finished && !_multishot) {
+				auto & waiters = _descriptors[descriptor];
+				int waiting = (waiters.reader ? Waiters::READ : 0) | (waiters.writer ? Waiters::WRITE : 0);
+				
+				if (descriptor == _wakeup) waiting = Waiters::READ;
+				
+				if (waiting & ~waiters.armed) {
+					rearm(descriptor, waiters.armed | waiting);
+				}
+			}
+		});
+	}
+	
+	struct io_uring_sqe * Reactor::submission(Operation & operation)
+	{
+		assert(_ring);
+		
+		auto entry = _ring->submission();
+		
+		std::size_t index;
+		
+		if (_available.empty()) {
+			index = _operations.size();
+			_operations.push_back(nullptr);
+		} else {
+			index = _available.back();
+			_available.pop_back();
 		}
+		
+		_operations[index] = &operation;
+		operation.user_data = index << 1;
+		
+		entry->user_data = operation.user_data;
+		
+		return entry;
 	}
 	
+	int Reactor::complete(Operation & operation)
+	{
+		// If the wait is cut short, e.g. by a deadline, the operation is cancelled:
+		operation.registration.result = -ECANCELED;
+		
+		auto defer_cancel = defer([&]{
+			if (!operation.completed) {
+				// The operation must not complete into this stack frame:
+				_operations[operation.user_data >> 1] = nullptr;
+				
+				auto entry = _ring->submission();
+				entry->opcode = IORING_OP_ASYNC_CANCEL;
+				entry->fd = -1;
+				entry->addr = operation.user_data;
+			}
+		});
+		
+		transfer();
+		
+		return operation.registration.result;
+	}
+	
+	bool Reactor::register_buffers(const struct iovec * buffers, unsigned count)
+	{
+		if (!_ring) return false;
+		
+		_ring->register_buffers(buffers, count);
+		
+		return true;
+	}
+	
+	bool Reactor::register_files(const Descriptor * descriptors, unsigned count)
+	{
+		if (!_ring) return false;
+		
+		_ring->register_files(descriptors, count);
+		
+		return true;
+	}
+#endif
+
 #elif defined(SCHEDULER_KQUEUE)
-	Reactor::Reactor() : _selector(::kqueue())
+	enum : uintptr_t {
+		WAKEUP = 1
+	};
+	
+	Reactor::Reactor(const Duration & resolution) : _timers(resolution), _selector(::kqueue())
 	{
 		_events.reserve(512);
+		
+		struct kevent event;
+		EV_SET(&event, WAKEUP, EVFILT_USER, EV_ADD | EV_CLEAR, 0, 0, nullptr);
+		append(event);
+	}
+	
+	void Reactor::notify()
+	{
+		struct kevent event;
+		EV_SET(&event, WAKEUP, EVFILT_USER, 0, NOTE_TRIGGER, 0, nullptr);
+		
+		// This doesn't touch `_changes`, so it's safe to call from another thread:
+		if (::kevent(_selector, &event, 1, nullptr, 0, nullptr) == -1)
+			throw std::system_error(errno, std::generic_category(), "kqueue");
 	}
 	
 	std::string filter_name(int16_t filter) {
@@ -243,6 +1108,7 @@ namespace Scheduler
 			case EVFILT_READ: return "EVFILT_READ";
 			case EVFILT_WRITE: return "EVFILT_WRITE";
 			case EVFILT_TIMER: return "EVFILT_TIMER";
+			case EVFILT_USER: return "EVFILT_USER";
 		}
 		
 		return std::to_string(filter);
@@ -282,9 +1148,16 @@ namespace Scheduler
 	
 	std::size_t Reactor::select_internal(struct timespec * timeout)
 	{
+		if (_busy_poll.limit && !(timeout && timeout->tv_sec == 0 && timeout->tv_nsec == 0)) {
+			if (auto count = spin(timeout)) return count;
+		}
+		
 		// TODO is this slow?
 		_events.resize(_events.capacity());
+		
+		selecting();
 		auto result = kevent(_selector, _changes.data(), _changes.size(), _events.data(), _events.size(), timeout);
+		selected(result > 0 ? result : 0);
 		
 		if (DEBUG) {
 			std::cerr << "select:kqueue = " << result << " errno = " << errno << std::endl;
@@ -308,11 +1181,19 @@ namespace Scheduler
 				std::cerr << "\tfiring " << event.ident << " " << filter_name(event.filter) << " " << flags_name(event.flags) << std::endl;
 			}
 			
-			auto registration = reinterpret_cast<Registration *>(event.udata);
-			registration->result = event.filter;
+			if (event.filter == EVFILT_USER) {
+				transfer_posted();
+				continue;
+			}
 			
-			auto fiber = registration->fiber;
-			if (fiber != nullptr) fiber->transfer();
+			// Events appended with an explicit registration are resumed directly, otherwise they belong to the descriptor table:
+			if (auto registration = reinterpret_cast<Registration *>(event.udata)) {
+				registration->result = event.filter;
+				
+				if (registration->waiting()) wake(*registration);
+			} else {
+				dispatch(event.ident, directions(event.filter), event.filter);
+			}
 		}
 		
 		_events.resize(0);
@@ -320,6 +1201,8 @@ namespace Scheduler
 		// If we received the maximum number of events, increase the size of the event buffer.
 		if (std::size_t(result) == _events.capacity()) {
 			_events.reserve(_events.capacity() * 2);
+			
+			if (_metrics) _metrics->event_growths += 1;
 		}
 		
 		return result;
@@ -345,5 +1228,50 @@ namespace Scheduler
 				throw std::system_error(errno, std::generic_category(), "kqueue");
 		}
 	}
+	
+	bool Reactor::set_kernel_busy_poll(std::uint32_t, std::uint16_t, bool)
+	{
+		return false;
+	}
+	
+	int Reactor::directions(int events)
+	{
+		switch (events) {
+			case EVFILT_READ: return Waiters::READ;
+			case EVFILT_WRITE: return Waiters::WRITE;
+		}
+		
+		return 0;
+	}
+	
+	void Reactor::update(Descriptor descriptor, int interest, int directions)
+	{
+		if (directions == 0) {
+			// Discard any changes which have not been applied yet:
+			_changes.erase(std::remove_if(_changes.begin(), _changes.end(), [&](const struct kevent & change){
+				return change.ident == static_cast<uintptr_t>(descriptor) && change.udata == nullptr;
+			}), _changes.end());
+			
+			struct kevent changes[2];
+			int count = 0;
+			
+			if (interest & Waiters::READ) EV_SET(&changes[count++], descriptor, EVFILT_READ, EV_DELETE, 0, 0, nullptr);
+			if (interest & Waiters::WRITE) EV_SET(&changes[count++], descriptor, EVFILT_WRITE, EV_DELETE, 0, 0, nullptr);
+			
+			// The descriptor may already have been closed, which removes it from the selector.
+			kevent(_selector, changes, count, nullptr, 0, nullptr);
+			
+			return;
+		}
+		
+		// The changes are applied by the next call to select, along with any errors which are reported as events:
+		if ((directions & Waiters::READ) && !(interest & Waiters::READ)) {
+			append({static_cast<uintptr_t>(descriptor), EVFILT_READ, EV_ADD | EV_CLEAR, 0, 0, nullptr}, false);
+		}
+		
+		if ((directions & Waiters::WRITE) && !(interest & Waiters::WRITE)) {
+			append({static_cast<uintptr_t>(descriptor), EVFILT_WRITE, EV_ADD | EV_CLEAR, 0, 0, nullptr}, false);
+		}
+	}
 #endif
 }
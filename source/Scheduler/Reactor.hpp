@@ -14,19 +14,34 @@
 
 #if defined(__linux__)
 	#define SCHEDULER_EPOLL
+	
+	// SCHEDULER_URING may be defined by the build to use io_uring, falling back to epoll at run time if the kernel refuses to set up the ring.
 #elif defined(__MACH__)
 	#define SCHEDULER_KQUEUE
 #endif
 
+#if defined(SCHEDULER_URING) && !defined(SCHEDULER_EPOLL)
+	#error "SCHEDULER_URING is only supported on Linux."
+#endif
+
 #include <vector>
-#include <list>
 #include <iostream>
 
+#include <atomic>
+#include <chrono>
+#include <functional>
+
+#include <optional>
+
 #include <Time/Interval.hpp>
-#include <Time/Queue.hpp>
 
 #if defined(SCHEDULER_EPOLL)
 	#include <sys/epoll.h>
+	
+	#if defined(SCHEDULER_URING)
+		#include <memory>
+		#include "Ring.hpp"
+	#endif
 #elif defined(SCHEDULER_KQUEUE)
 	#include <sys/types.h>
 	#include <sys/event.h>
@@ -37,26 +52,46 @@
 
 #include "Handle.hpp"
 #include "Fiber.hpp"
+#include "FiberPool.hpp"
+#include "Histogram.hpp"
+#include "List.hpp"
+#include "Wheel.hpp"
 
 namespace Scheduler
 {
 	using Time::Timestamp;
 	using Time::Duration;
 	
+	class Deadline;
+	
 	class Reactor final
 	{
 	public:
 		struct Registration;
+		
+		// Fibers which are ready to run are resumed in priority order. Readiness events from the selector are collected first, so a latency critical fiber is resumed before background fibers which became ready at the same time.
+		enum class Priority : std::uint8_t {
+			CRITICAL,
+			NORMAL,
+			BACKGROUND,
+		};
+		
+		enum : std::size_t {
+			PRIORITIES = 3
+		};
 	
 	private:
 		struct TimeoutHandle {
+			Reactor *reactor = nullptr;
 			Registration *registration = nullptr;
 			
 			void operator()()
 			{
 				if (registration) {
 					registration->result = 0;
-					registration->fiber->transfer();
+					
+					// A deadline only has a fiber while the fiber is waiting:
+					if (registration->waiting()) reactor->wake(*registration);
 				}
 			}
 			
@@ -71,43 +106,118 @@ namespace Scheduler
 			}
 		};
 		
-		using Timers = Time::Queue<TimeoutHandle>;
+		using Timers = Wheel<TimeoutHandle>;
 		Timers _timers;
 		
+		Duration _slack = Duration(0);
+	
 	public:
 		static thread_local Reactor * current;
 		struct Bound;
 		
-		struct Registration {
+		// A fiber in the ready list, which is removed when it's destroyed, e.g. if the fiber was resumed by something else. It has the priority of the fiber which created it.
+		struct Ready : public Link {
+			Fiber * fiber;
+			Priority priority;
+			
+			// If set, this is invoked on the reactor's stack instead of resuming the fiber, e.g. to resume a coroutine.
+			void (*callback)(void * context) = nullptr;
+			void * context = nullptr;
+			
+			Ready(Fiber * fiber_ = Fiber::current, Priority priority_ = current ? current->priority() : Priority::NORMAL) : fiber(fiber_), priority(priority_) {}
+			
+			~Ready()
+			{
+				if (linked()) unlink();
+			}
+			
+			// Whether there is anything to resume.
+			bool waiting() const noexcept {return fiber || callback;}
+		};
+		
+		// A fiber waiting for an event, which is added to the ready list when the event occurs.
+		struct Registration : public Ready {
 			int result = 0;
-			Fiber * fiber = nullptr;
+			
+			// If set, the callback is invoked as soon as the event occurs, directly from the selector or timer wheel, rather than from the ready list. It must not suspend, and shouldn't do much work, since other events are still being dispatched.
+			bool immediate = false;
 			
 			Timers::EventReference timeout_event;
 			
-			Registration(int result_ = 0, Fiber *fiber_ = Fiber::current) : result(result_), fiber(fiber_) {}
+			Registration(int result_ = 0, Fiber *fiber_ = Fiber::current) : Ready(fiber_), result(result_) {}
 			
 			~Registration()
 			{
-				if (timeout_event) timeout_event->handle.cancel();
+				timeout_event.cancel();
 			}
 			
-			void schedule(Timers & timers, const Timestamp & timeout);
+			void schedule(Reactor & reactor, const Timestamp & timeout, const Duration & slack = Duration(0));
 		};
 		
-		Reactor();
+		// The resolution of the timer wheel determines how precisely timeouts are scheduled.
+		Reactor(const Duration & resolution = Duration(0.001));
 		~Reactor();
 		
 		auto now() const noexcept {return _timers.now();}
 		
-		// Transfer to the reactor. The current fiber will be marked as waiting.
-		void transfer();
+		// Run the function in a fiber from the reactor's fiber pool, starting it immediately. If called from a fiber, that fiber is resumed when the new fiber yields.
+		void spawn(std::function<void()> function, std::size_t stack_size = 0);
+		
+		// The fibers used by `spawn`.
+		FiberPool & fibers() noexcept {return _fibers;}
+		
+		// Transfer to the reactor. The current fiber will be marked as waiting. If the fiber is within a `Deadline` scope, it is resumed when the deadline expires, and doesn't wait at all once it has.
+		// @returns false if the deadline expired.
+		bool transfer();
 		
 		// Transfer to the specified fiber, mark the current fiber as ready.
 		void transfer(Fiber * fiber);
 		
-		// Sleep for the specified interval.
+		// Add the fiber to the ready list, so that it's resumed by the event loop, without transferring to it now. The node must remain valid until the fiber is resumed, e.g. by living on the fiber's stack.
+		void ready(Ready & ready) noexcept
+		{
+			if (!ready.linked()) _ready[std::size_t(ready.priority)].push_back(ready);
+		}
+		
+		// The priority of the running fiber, which is restored whenever it's resumed. Fibers inherit the priority of the fiber which started them, and fibers started outside a fiber are `NORMAL`.
+		Priority priority() const noexcept {return _priority;}
+		void set_priority(Priority priority) noexcept {_priority = priority;}
+		
+		// The counter of waits by the running fiber, which is restored whenever it's resumed, and incremented each time the fiber waits while metrics are enabled. Fibers from `spawn` count their own waits (see `FiberPool::waits`), and other fibers don't count them unless they set a counter.
+		std::uint64_t * waits() const noexcept {return _waits;}
+		void set_waits(std::uint64_t * waits) noexcept {_waits = waits;}
+		
+		// Each priority class is resumed at least once for every `limit` fibers resumed from higher classes while it was waiting, so that background fibers still make progress.
+		void set_starvation_limit(std::size_t limit) noexcept {_starvation_limit = limit ? limit : 1;}
+		
+		// Sleep for the specified interval. The wakeup may be deferred by up to `slack` (or the reactor's slack if not specified) so that it can be coalesced with other timers.
 		// @returns true if the sleep was not interrupted.
-		bool sleep(Fiber * fiber, const Timestamp & until);
+		bool sleep(Fiber * fiber, const Timestamp & until, const Duration * slack = nullptr);
+		
+		// Sleep using the specified registration, which resumes its fiber. The registration can be reused, so that its timer is re-armed in place.
+		bool sleep(Registration & registration, const Timestamp & until, const Duration * slack = nullptr);
+		
+		// The default slack for timers, including timeouts. Timers with deadlines in the same slack window fire together in one iteration of the loop.
+		const Duration & slack() const noexcept {return _slack;}
+		void set_slack(const Duration & slack) noexcept {_slack = slack;}
+		
+		// The number of wakeups which were avoided by timer slack.
+		std::size_t coalesced() const noexcept {return _timers.coalesced();}
+		
+		// Wait for the descriptor to become ready for the specified events. The descriptor is registered with the selector the first time it is used and remains registered until it is forgotten.
+		// @returns the events which occurred, or 0 if the timeout expired.
+		int wait(Descriptor descriptor, int events, const Timestamp * timeout = nullptr);
+		
+		// Make the registration ready when the descriptor becomes ready for the specified events, without suspending. This is how waiters which aren't fibers (e.g. coroutines) wait for descriptors. The registration must be removed with `unwatch` before it's destroyed.
+		// @returns the events if the descriptor is already ready, in which case the registration isn't added.
+		int watch(Descriptor descriptor, int events, Registration & registration);
+		void unwatch(Descriptor descriptor, Registration & registration);
+		
+		// Remove any persistent registration for the descriptor before it is closed. Only the owner of the descriptor should do this, since it discards the registrations of anything waiting on it. A descriptor which is closed without being forgotten (e.g. with `::close`) is re-registered if its number is reused, but that costs a system call.
+		void forget(Descriptor descriptor);
+		
+		// Register a descriptor which is shared with other reactors (e.g. a listening socket) for reading, so that only one of them is woken for each event. This must be called before the descriptor is waited on, and it must not be waited on for writing. If the selector doesn't support exclusive wakeups (i.e. with io_uring or kqueue), the descriptor is registered normally when it's waited on.
+		void exclusive(Descriptor descriptor);
 		
 		// Run the reactor until all fibers are completed.
 		std::size_t run();
@@ -115,18 +225,231 @@ namespace Scheduler
 		// Run the reactor until all fibers are completed or the specified duration has elapsed.
 		std::size_t run(const Duration & duration);
 		
+		// Run a single iteration of the event loop, waiting at most the specified duration for events, or indefinitely if no duration is given.
+		std::size_t run_once(const std::optional<Duration> & duration);
+		
+		// Invoke the callable on the thread running the reactor. This is safe to call from any thread. Posts made before the reactor wakes up share a single wakeup.
+		void post(std::function<void()> callable);
+		
+		// Resume a fiber which is waiting on this reactor, from the ready list with the specified priority. This is safe to call from any thread.
+		void resume(Fiber * fiber, Priority priority = Priority::NORMAL);
+
+#if defined(SCHEDULER_URING)
+		const Handle & handle() const noexcept {return _ring ? _ring->handle() : _selector;}
+		Handle & handle() noexcept {return _ring ? _ring->handle() : _selector;}
+#else
 		const Handle & handle() const noexcept {return _selector;}
 		Handle & handle() noexcept {return _selector;}
+#endif
 		
 		bool waiting() const noexcept {
 			return _waiting;
 		}
 		
+		// Waiters which aren't fibers (e.g. coroutines) are counted explicitly, so that `run` continues until they are resumed.
+		void add_waiting() noexcept {_waiting += 1;}
+		void remove_waiting() noexcept {_waiting -= 1;}
+		
+		// Counters which describe how busy the event loop is. Times are in nanoseconds.
+		struct Metrics {
+			// The number of times the selector was called.
+			std::uint64_t iterations = 0;
+			
+			// The time spent blocked in the selector, and the time spent between calls to it, e.g. running fibers and timers.
+			std::uint64_t select_time = 0;
+			std::uint64_t run_time = 0;
+			
+			// The number of events returned by the selector, in total and the most in a single call.
+			std::uint64_t events = 0;
+			std::uint64_t max_events = 0;
+			
+			// The capacity of the event buffer, and the number of times it grew.
+			std::uint64_t event_capacity = 0;
+			std::uint64_t event_growths = 0;
+			
+			// The number of fibers resumed from the ready list, in total and the most in a single pass.
+			std::uint64_t ready = 0;
+			std::uint64_t max_ready = 0;
+			
+			// The number of times fibers waited on the reactor. Each fiber's own count is kept by its counter (see `set_waits`).
+			std::uint64_t waits = 0;
+			
+			// How late timers fired, relative to the tick they were scheduled for.
+			Histogram timer_lateness;
+		};
+		
+		// Metrics are always compiled in, but only recorded while enabled. Enabling them resets them.
+		void set_metrics(bool enabled);
+		bool metrics_enabled() const noexcept {return _metrics != nullptr;}
+		
+		// A snapshot of the metrics recorded since they were enabled or reset.
+		Metrics metrics() const;
+		void reset_metrics();
+		
+		// The state of busy polling. Times are in nanoseconds.
+		struct BusyPoll {
+			// The most time to spend spinning before blocking, and the current budget, which adapts to how often spinning finds events.
+			std::uint64_t limit = 0;
+			std::uint64_t budget = 0;
+			
+			// The number of times the reactor spun, the number of those which found events, and how many events they found.
+			std::uint64_t spins = 0;
+			std::uint64_t hits = 0;
+			std::uint64_t events = 0;
+			
+			// The wall-clock time spent spinning. The thread doesn't block while it spins, but this isn't a measure of CPU time, e.g. if the thread is preempted.
+			std::uint64_t time = 0;
+		};
+		
+		// Before blocking, poll the selector without blocking for up to `limit`, which avoids the cost of sleeping and waking the thread when events arrive soon. A limit of zero disables busy polling.
+		void set_busy_poll(const Duration & limit);
+		const BusyPoll & busy_poll() const noexcept {return _busy_poll;}
+		
+		// Ask the kernel to busy poll the network devices of sockets registered with the selector (see EPIOCSPARAMS).
+		// @returns false if this isn't supported by the platform, the kernel or the backend.
+		bool set_kernel_busy_poll(std::uint32_t microseconds, std::uint16_t budget = 8, bool prefer = false);
+
+#if defined(SCHEDULER_URING)
+		// An asynchronous operation submitted to the ring, which resumes the waiting fiber when it completes.
+		struct Operation {
+			Registration registration;
+			
+			std::uint64_t user_data = 0;
+			bool completed = false;
+		};
+		
+		// Whether operations can be submitted, otherwise the reactor fell back to epoll.
+		bool completions() const noexcept {return _ring != nullptr;}
+		
+		// Allocate a submission queue entry for the operation. The caller should fill it in (except for `user_data`) and then call `complete`.
+		struct io_uring_sqe * submission(Operation & operation);
+		
+		// Wait for the operation to complete. If the fiber is stopped, the operation is cancelled.
+		// @returns the result of the operation, which is a negated errno on failure.
+		int complete(Operation & operation);
+		
+		// Register buffers and descriptors for fixed operations, which avoids pinning pages and looking up descriptors for every operation.
+		// @returns false if the reactor fell back to epoll.
+		bool register_buffers(const struct iovec * buffers, unsigned count);
+		bool register_files(const Descriptor * descriptors, unsigned count);
+#endif
+	
 	private:
 		Handle _selector;
 		
 		std::size_t _waiting = 0;
-		std::list<Fiber *> _ready;
+		
+		std::unique_ptr<Metrics> _metrics;
+		
+		BusyPoll _busy_poll;
+		
+		// Poll the selector without blocking, for at most the busy poll budget and the timeout, which is reduced by the time spent.
+		// @returns the number of events, or 0 if nothing was found and the caller should block.
+		std::size_t spin(struct timespec * timeout);
+		
+		// When the selector last returned, or started.
+		std::chrono::steady_clock::time_point _selected, _selecting;
+		
+		// Record the time spent in the selector, and between calls to it.
+		void selecting() {if (_metrics) record_selecting();}
+		void selected(std::size_t events) {if (_metrics) record_selected(events);}
+		
+		void record_selecting();
+		void record_selected(std::size_t events);
+		
+		// A ready list for each priority class, and the number of fibers resumed from higher classes while each class was waiting.
+		List<Ready> _ready[PRIORITIES];
+		std::size_t _bypassed[PRIORITIES] = {0};
+		std::size_t _starvation_limit = 16;
+		
+		Priority _priority = Priority::NORMAL;
+		std::uint64_t * _waits = nullptr;
+		
+		// Resume the registration once its event has occurred: immediate callbacks are invoked now, and anything else is added to the ready list.
+		void wake(Registration & registration)
+		{
+			if (registration.immediate) registration.callback(registration.context);
+			else ready(registration);
+		}
+		
+		// The innermost deadline scope of the running fiber, which is restored whenever it's resumed.
+		friend class Deadline;
+		Deadline * _deadline = nullptr;
+		
+		Ready * next_ready();
+		
+		// Whether any fibers are in the ready lists.
+		bool runnable() const noexcept;
+		
+		// A callable posted from another thread.
+		struct Posted {
+			std::atomic<Posted *> next{nullptr};
+			std::function<void()> callable;
+		};
+		
+		// An intrusive lock-free queue with multiple producers and a single consumer. Producers push onto the head, and the reactor consumes from the tail, which is initially the stub.
+		Posted _stub;
+		std::atomic<Posted *> _head{&_stub};
+		Posted * _tail = &_stub;
+		
+		// Set by the first post after the reactor wakes up, so that subsequent posts don't need to wake it again.
+		std::atomic<bool> _notified{false};
+		
+		void push(Posted * posted);
+		Posted * pop();
+		
+		// Wake up the selector from another thread.
+		void notify();
+		
+		// Invoke all posted callables.
+		std::size_t transfer_posted();
+		
+		// The state of a descriptor which is registered with the selector.
+		struct Waiters {
+			enum : int {
+				READ = 1,
+				WRITE = 2,
+			};
+			
+			// The registrations waiting for the descriptor to become readable or writable.
+			Registration * reader = nullptr;
+			Registration * writer = nullptr;
+			
+			// The directions the selector is monitoring.
+			int interest = 0;
+			
+			// The directions which became ready while nothing was waiting.
+			int ready = 0;
+			
+			// The file the descriptor referred to when it was registered, so that a descriptor which was closed without being forgotten and then reused can be detected.
+			std::uint64_t device = 0, inode = 0;
+			
+			// The number of times the descriptor has been forgotten.
+			std::uint32_t generation = 0;
+			
+			// The directions of the pending poll, if the ring only supports one-shot polls. These complete immediately if the descriptor is already ready, so they are only armed while something is waiting.
+			int armed = 0;
+		};
+		
+		// A flat table of descriptor state, indexed by descriptor.
+		std::vector<Waiters> _descriptors;
+		
+		Waiters & waiters(Descriptor descriptor);
+		
+		// Record the file which the descriptor refers to when it's registered.
+		static void identify(Descriptor descriptor, Waiters & waiters);
+		
+		// Whether the descriptor still refers to the file which was registered.
+		static bool registered(Descriptor descriptor, const Waiters & waiters);
+		
+		// Resume any registrations waiting for the specified directions.
+		void dispatch(Descriptor descriptor, int directions, int result);
+		
+		// Convert the events used by the selector into directions.
+		static int directions(int events);
+		
+		// Update the selector so that it monitors the specified directions.
+		void update(Descriptor descriptor, int interest, int directions);
 		
 		std::size_t transfer_ready();
 		std::optional<Timestamp> transfer_timers();
@@ -137,29 +460,60 @@ namespace Scheduler
 		// Wait at most the specified duration for events:
 		std::size_t select(Duration duration);
 		std::size_t select(const std::optional<Duration> & duration);
-		
+
 #if defined(SCHEDULER_EPOLL)
 	public:
 		std::size_t select_internal(struct timespec * timeout);
-		void append(int operation, Descriptor descriptor, int events, Registration * registration, const Timestamp *timeout = nullptr);
-		
+	
 	private:
 		std::vector<struct epoll_event> _events;
+		
+		// An eventfd which is registered with the selector for the lifetime of the reactor, used by `notify`.
+		Handle _wakeup;
+		void register_wakeup();
+
+#if defined(SCHEDULER_URING)
+		// If the kernel supports it, the ring is used instead of epoll.
+		std::unique_ptr<Ring> _ring;
+		
+		// Whether poll registrations can complete more than once, otherwise they are re-armed after each completion.
+		bool _multishot = true;
+		
+		// Completions for descriptor polls are tagged in the low bit, otherwise the completion is for an operation. A `user_data` of 0 is ignored. Polls also carry the generation of the descriptor in the high 32 bits, so that completions which were queued before it was forgotten are discarded.
+		enum : std::uint64_t {
+			POLL = 1
+		};
+		
+		std::uint64_t poll_data(Descriptor descriptor) {return (std::uint64_t(waiters(descriptor).generation) << 32) | (std::uint64_t(descriptor) << 1) | POLL;}
+		
+		// Operations in flight, indexed by `user_data >> 1`. Slot 0 is never used. If an operation is abandoned, its slot is cleared but is not reused until the operation completes.
+		std::vector<Operation *> _operations;
+		std::vector<std::size_t> _available;
+		
+		std::size_t select_ring(struct timespec * timeout);
+		void arm(Descriptor descriptor, int directions);
+		
+		// Replace the pending one-shot poll with one for the specified directions.
+		void rearm(Descriptor descriptor, int directions);
+#endif
 #elif defined(SCHEDULER_KQUEUE)
 	public:
 		std::size_t select_internal(struct timespec * timeout);
 		void append(const struct kevent & event, bool flush = true);
-		
+	
 	private:
 		std::vector<struct kevent> _changes;
 		std::vector<struct kevent> _events;
 #endif
+		
+		// Destroyed first, as stopping fibers which are still running may unwind into the rest of the reactor:
+		FiberPool _fibers;
 	};
 	
 	struct Reactor::Bound {
 		Reactor reactor;
 		
-		Bound()
+		Bound(const Duration & resolution = Duration(0.001)) : reactor(resolution)
 		{
 			if (Reactor::current != nullptr)
 				throw std::runtime_error("Reactor::current is already set!");
@@ -0,0 +1,201 @@
+//
+//  Ring.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#if defined(SCHEDULER_URING)
+
+#include "Ring.hpp"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <time.h>
+
+#include <cstring>
+#include <system_error>
+
+namespace Scheduler
+{
+	static int io_uring_setup(unsigned entries, struct io_uring_params * parameters)
+	{
+		return ::syscall(__NR_io_uring_setup, entries, parameters);
+	}
+	
+	static int io_uring_enter(int descriptor, unsigned submit, unsigned complete, unsigned flags, const void * argument, std::size_t size)
+	{
+		return ::syscall(__NR_io_uring_enter, descriptor, submit, complete, flags, argument, size);
+	}
+	
+	static int io_uring_register(int descriptor, unsigned opcode, const void * argument, unsigned count)
+	{
+		return ::syscall(__NR_io_uring_register, descriptor, opcode, argument, count);
+	}
+	
+	static void * map(Descriptor descriptor, std::size_t size, off_t offset)
+	{
+		auto address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, descriptor, offset);
+		
+		if (address == MAP_FAILED)
+			throw std::system_error(errno, std::generic_category(), "mmap");
+		
+		return address;
+	}
+	
+	Ring::Mapping::~Mapping()
+	{
+		if (address) ::munmap(address, size);
+	}
+	
+	Ring::Ring(unsigned entries)
+	{
+		struct io_uring_params parameters;
+		std::memset(&parameters, 0, sizeof(parameters));
+		
+		// Persistent poll registrations can complete many times per submission, so the completion queue is larger:
+		parameters.flags = IORING_SETUP_CQSIZE;
+		parameters.cq_entries = entries * 4;
+		
+		auto descriptor = io_uring_setup(entries, &parameters);
+		
+		if (descriptor == -1)
+			throw std::system_error(errno, std::generic_category(), "io_uring_setup");
+		
+		_handle = Handle(descriptor);
+		_features = parameters.features;
+		
+		// We rely on being able to wait with a timeout without submitting a timeout operation:
+		if (!(_features & IORING_FEAT_EXT_ARG))
+			throw std::system_error(ENOSYS, std::generic_category(), "io_uring_setup");
+		
+		_queues.size = parameters.sq_off.array + parameters.sq_entries * sizeof(unsigned);
+		_completions.size = parameters.cq_off.cqes + parameters.cq_entries * sizeof(struct io_uring_cqe);
+		
+		if (_features & IORING_FEAT_SINGLE_MMAP) {
+			if (_completions.size > _queues.size) _queues.size = _completions.size;
+			_queues.address = map(descriptor, _queues.size, IORING_OFF_SQ_RING);
+		} else {
+			_queues.address = map(descriptor, _queues.size, IORING_OFF_SQ_RING);
+			_completions.address = map(descriptor, _completions.size, IORING_OFF_CQ_RING);
+		}
+		
+		_submissions.size = parameters.sq_entries * sizeof(struct io_uring_sqe);
+		_submissions.address = map(descriptor, _submissions.size, IORING_OFF_SQES);
+		
+		auto queues = static_cast<char *>(_queues.address);
+		auto completions = _completions.address ? static_cast<char *>(_completions.address) : queues;
+		
+		_submission.head = reinterpret_cast<unsigned *>(queues + parameters.sq_off.head);
+		_submission.tail = reinterpret_cast<unsigned *>(queues + parameters.sq_off.tail);
+		_submission.array = reinterpret_cast<unsigned *>(queues + parameters.sq_off.array);
+		_submission.mask = *reinterpret_cast<unsigned *>(queues + parameters.sq_off.ring_mask);
+		_submission.size = parameters.sq_entries;
+		_submission.entries = static_cast<struct io_uring_sqe *>(_submissions.address);
+		
+		// The submission array is an indirection we don't need, so it maps each slot to itself:
+		for (unsigned index = 0; index < _submission.size; index += 1) {
+			_submission.array[index] = index;
+		}
+		
+		_completion.head = reinterpret_cast<unsigned *>(completions + parameters.cq_off.head);
+		_completion.tail = reinterpret_cast<unsigned *>(completions + parameters.cq_off.tail);
+		_completion.mask = *reinterpret_cast<unsigned *>(completions + parameters.cq_off.ring_mask);
+		_completion.entries = reinterpret_cast<struct io_uring_cqe *>(completions + parameters.cq_off.cqes);
+	}
+	
+	Ring::~Ring()
+	{
+	}
+	
+	struct io_uring_sqe * Ring::submission()
+	{
+		auto head = __atomic_load_n(_submission.head, __ATOMIC_ACQUIRE);
+		auto tail = *_submission.tail + _pending;
+		
+		if (tail - head >= _submission.size) {
+			enter();
+			
+			head = __atomic_load_n(_submission.head, __ATOMIC_ACQUIRE);
+			tail = *_submission.tail + _pending;
+			
+			if (tail - head >= _submission.size)
+				throw std::system_error(EBUSY, std::generic_category(), "io_uring_enter");
+		}
+		
+		auto entry = &_submission.entries[tail & _submission.mask];
+		std::memset(entry, 0, sizeof(*entry));
+		
+		_pending += 1;
+		
+		return entry;
+	}
+	
+	bool Ring::enter(unsigned count, const struct timespec * timeout)
+	{
+		// Publish the prepared entries to the kernel:
+		if (_pending) {
+			__atomic_store_n(_submission.tail, *_submission.tail + _pending, __ATOMIC_RELEASE);
+			_pending = 0;
+		}
+		
+		// This includes any entries the kernel did not consume last time:
+		unsigned submit = *_submission.tail - __atomic_load_n(_submission.head, __ATOMIC_ACQUIRE);
+		
+		if (submit == 0 && count == 0) return true;
+		
+		unsigned flags = 0;
+		struct __kernel_timespec interval;
+		struct io_uring_getevents_arg argument;
+		std::memset(&argument, 0, sizeof(argument));
+		argument.sigmask_sz = _NSIG / 8;
+		
+		if (count) {
+			flags |= IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+			
+			if (timeout) {
+				interval.tv_sec = timeout->tv_sec;
+				interval.tv_nsec = timeout->tv_nsec;
+				argument.ts = reinterpret_cast<uintptr_t>(&interval);
+			}
+		}
+		
+		auto result = io_uring_enter(_handle, submit, count, flags, count ? &argument : nullptr, count ? sizeof(argument) : 0);
+		
+		if (result == -1) {
+			if (errno == EINTR || errno == ETIME)
+				return false;
+			
+			// The completion queue is full, so completions must be processed before more work can be submitted:
+			if (errno == EBUSY || errno == EAGAIN)
+				return true;
+			
+			throw std::system_error(errno, std::generic_category(), "io_uring_enter");
+		}
+		
+		return true;
+	}
+	
+	void Ring::register_buffers(const struct iovec * buffers, unsigned count)
+	{
+		// This fails with ENXIO if nothing was registered, which is fine:
+		io_uring_register(_handle, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+		
+		if (count && io_uring_register(_handle, IORING_REGISTER_BUFFERS, buffers, count) == -1)
+			throw std::system_error(errno, std::generic_category(), "io_uring_register");
+	}
+	
+	void Ring::register_files(const Descriptor * descriptors, unsigned count)
+	{
+		io_uring_register(_handle, IORING_UNREGISTER_FILES, nullptr, 0);
+		
+		if (count && io_uring_register(_handle, IORING_REGISTER_FILES, descriptors, count) == -1)
+			throw std::system_error(errno, std::generic_category(), "io_uring_register");
+	}
+}
+
+#endif
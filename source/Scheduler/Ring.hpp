@@ -0,0 +1,122 @@
+//
+//  Ring.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Handle.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <linux/io_uring.h>
+
+struct timespec;
+struct iovec;
+
+namespace Scheduler
+{
+	// A minimal interface to the io_uring submission and completion queues.
+	class Ring final
+	{
+	public:
+		// Create a ring with at least the specified number of submission queue entries.
+		// @throws std::system_error if the kernel refuses to set up the ring.
+		Ring(unsigned entries);
+		~Ring();
+		
+		Ring(const Ring &) = delete;
+		Ring & operator=(const Ring &) = delete;
+		
+		const Handle & handle() const noexcept {return _handle;}
+		Handle & handle() noexcept {return _handle;}
+		
+		unsigned features() const noexcept {return _features;}
+		
+		// The number of entries which have been prepared but not submitted.
+		std::size_t pending() const noexcept {return _pending;}
+		
+		// The number of completions which are available.
+		std::size_t available() const noexcept
+		{
+			return __atomic_load_n(_completion.tail, __ATOMIC_ACQUIRE) - *_completion.head;
+		}
+		
+		// Get a zeroed submission queue entry. If the queue is full, pending entries are submitted first.
+		struct io_uring_sqe * submission();
+		
+		// Submit all pending entries and wait for at least `count` completions or until the timeout expires.
+		// @returns false if the wait was interrupted or timed out.
+		bool enter(unsigned count = 0, const struct timespec * timeout = nullptr);
+		
+		// Register buffers which can be used by fixed buffer operations, replacing any previously registered buffers.
+		void register_buffers(const struct iovec * buffers, unsigned count);
+		
+		// Register descriptors which can be used by fixed file operations, replacing any previously registered descriptors.
+		void register_files(const Descriptor * descriptors, unsigned count);
+		
+		// Invoke the callback for each available completion, directly from the completion queue.
+		// @returns the number of completions processed.
+		template <typename Callback>
+		std::size_t complete(Callback callback)
+		{
+			std::size_t count = 0;
+			
+			auto head = *_completion.head;
+			auto tail = __atomic_load_n(_completion.tail, __ATOMIC_ACQUIRE);
+			
+			while (head != tail) {
+				const auto & entry = _completion.entries[head & _completion.mask];
+				
+				auto user_data = entry.user_data;
+				auto result = entry.res;
+				auto flags = entry.flags;
+				
+				// Release the entry before invoking the callback, which may submit more work:
+				head += 1;
+				__atomic_store_n(_completion.head, head, __ATOMIC_RELEASE);
+				
+				callback(user_data, result, flags);
+				count += 1;
+			}
+			
+			return count;
+		}
+	
+	private:
+		Handle _handle;
+		unsigned _features = 0;
+		std::size_t _pending = 0;
+		
+		struct Mapping {
+			void * address = nullptr;
+			std::size_t size = 0;
+			
+			~Mapping();
+		};
+		
+		Mapping _queues, _completions, _submissions;
+		
+		struct {
+			unsigned * head = nullptr;
+			unsigned * tail = nullptr;
+			unsigned * array = nullptr;
+			unsigned mask = 0;
+			unsigned size = 0;
+			
+			struct io_uring_sqe * entries = nullptr;
+		} _submission;
+		
+		struct {
+			unsigned * head = nullptr;
+			unsigned * tail = nullptr;
+			unsigned mask = 0;
+			
+			struct io_uring_cqe * entries = nullptr;
+		} _completion;
+	};
+}
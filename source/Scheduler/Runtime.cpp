@@ -0,0 +1,257 @@
+//
+//  Runtime.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Runtime.hpp"
+#include "Defer.hpp"
+
+#include <cassert>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include <system_error>
+
+namespace Scheduler
+{
+	struct Runtime::Core {
+		Runtime & runtime;
+		std::size_t index;
+		int cpu;
+		
+		// Set by the thread once it has started:
+		Reactor * reactor = nullptr;
+		int error = 0;
+		
+		// Functions which were spawned on this core and haven't started yet. Only accessed by the core's thread.
+		std::vector<std::function<void()>> spawned;
+		
+		std::thread thread;
+		
+		static thread_local Core * current;
+		
+		Core(Runtime & runtime_, std::size_t index_, int cpu_) : runtime(runtime_), index(index_), cpu(cpu_) {}
+		
+		void run();
+	};
+	
+	thread_local Runtime::Core * Runtime::Core::current = nullptr;
+	
+	void Runtime::Core::run()
+	{
+		int error = 0;
+
+#if defined(SCHEDULER_EPOLL)
+		// Pin the thread before it allocates anything, so that its memory is local to the CPU:
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		
+		error = ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+#endif
+		
+		Reactor::Bound bound;
+		current = this;
+		
+		{
+			std::lock_guard<std::mutex> lock(runtime._mutex);
+			
+			this->reactor = &bound.reactor;
+			this->error = error;
+			
+			runtime._started += 1;
+		}
+		
+		runtime._condition.notify_all();
+		
+		while (true) {
+			// Fibers are started from the event loop, rather than from the posted callable, which runs in the middle of processing events:
+			auto functions = std::move(spawned);
+			spawned.clear();
+			
+			for (auto & function : functions) {
+				bound.reactor.spawn(std::move(function));
+			}
+			
+			if (spawned.empty() && !bound.reactor.waiting() && runtime._stopping.load(std::memory_order_acquire)) break;
+			
+			bound.reactor.run_once(std::nullopt);
+		}
+		
+		current = nullptr;
+	}
+	
+	std::vector<int> Runtime::available()
+	{
+		std::vector<int> cpus;
+
+#if defined(SCHEDULER_EPOLL)
+		cpu_set_t set;
+		
+		if (::sched_getaffinity(0, sizeof(set), &set) == -1)
+			throw std::system_error(errno, std::generic_category(), "sched_getaffinity");
+		
+		for (int cpu = 0; cpu < CPU_SETSIZE; cpu += 1) {
+			if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+		}
+#else
+		for (unsigned cpu = 0; cpu < std::thread::hardware_concurrency(); cpu += 1) {
+			cpus.push_back(cpu);
+		}
+#endif
+		
+		if (cpus.empty()) cpus.push_back(0);
+		
+		return cpus;
+	}
+	
+	Runtime::Runtime(const std::vector<int> & cpus)
+	{
+		auto selected = cpus.empty() ? available() : cpus;
+		
+		for (std::size_t index = 0; index < selected.size(); index += 1) {
+			_cores.push_back(std::make_unique<Core>(*this, index, selected[index]));
+		}
+		
+		for (auto & core : _cores) {
+			core->thread = std::thread(&Core::run, core.get());
+		}
+		
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			
+			_condition.wait(lock, [&]{
+				return _started == _cores.size();
+			});
+		}
+		
+		for (auto & core : _cores) {
+			if (auto error = core->error) {
+				stop();
+				
+				throw std::system_error(error, std::generic_category(), "pthread_setaffinity_np");
+			}
+		}
+	}
+	
+	Runtime::~Runtime()
+	{
+		wait();
+		stop();
+	}
+	
+	void Runtime::stop()
+	{
+		_stopping.store(true, std::memory_order_release);
+		
+		for (auto & core : _cores) {
+			// Wake up the core, so that it notices it's stopping:
+			core->reactor->post([]{});
+		}
+		
+		for (auto & core : _cores) {
+			core->thread.join();
+		}
+	}
+	
+	std::size_t Runtime::current()
+	{
+		assert(Core::current);
+		
+		return Core::current->index;
+	}
+	
+	Reactor & Runtime::reactor(std::size_t core)
+	{
+		return *_cores.at(core)->reactor;
+	}
+	
+	void Runtime::spawn(std::size_t index, std::function<void()> function)
+	{
+		auto core = _cores.at(index).get();
+		
+		_outstanding.fetch_add(1, std::memory_order_relaxed);
+		
+		core->reactor->post([this, core, function = std::move(function)]() mutable {
+			core->spawned.push_back([this, function = std::move(function)]{
+				auto defer_finish = defer([this]{finish();});
+				
+				function();
+			});
+		});
+	}
+	
+	void Runtime::spawn_all(std::function<void(std::size_t core)> function)
+	{
+		for (std::size_t index = 0; index < _cores.size(); index += 1) {
+			spawn(index, [function, index]{
+				function(index);
+			});
+		}
+	}
+	
+	void Runtime::post(std::size_t core, std::function<void()> callable)
+	{
+		_cores.at(core)->reactor->post(std::move(callable));
+	}
+	
+	void Runtime::finish()
+	{
+		// Only the last fiber takes the lock:
+		if (_outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			std::lock_guard<std::mutex> lock(_mutex);
+			_condition.notify_all();
+		}
+	}
+	
+	void Runtime::wait()
+	{
+		assert(Core::current == nullptr);
+		
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		_condition.wait(lock, [&]{
+			return _outstanding.load(std::memory_order_acquire) == 0;
+		});
+	}
+	
+	Handle Runtime::listen(const struct sockaddr * address, socklen_t length, int backlog)
+	{
+#if defined(SOCK_NONBLOCK) && defined(SOCK_CLOEXEC)
+		Handle handle(::socket(address->sa_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0));
+#else
+		Handle handle(::socket(address->sa_family, SOCK_STREAM, 0));
+		
+		if (handle) {
+			update_flags(handle, O_NONBLOCK);
+			
+			// The close-on-exec flag is a descriptor flag, so `F_SETFL` would ignore it:
+			::fcntl(handle, F_SETFD, FD_CLOEXEC);
+		}
+#endif
+		
+		if (!handle)
+			throw std::system_error(errno, std::generic_category(), "socket");
+		
+		int value = 1;
+		
+		if (::setsockopt(handle, SOL_SOCKET, SO_REUSEADDR, &value, sizeof(value)) == -1)
+			throw std::system_error(errno, std::generic_category(), "setsockopt(SO_REUSEADDR)");
+		
+		if (::setsockopt(handle, SOL_SOCKET, SO_REUSEPORT, &value, sizeof(value)) == -1)
+			throw std::system_error(errno, std::generic_category(), "setsockopt(SO_REUSEPORT)");
+		
+		if (::bind(handle, address, length) == -1)
+			throw std::system_error(errno, std::generic_category(), "bind");
+		
+		if (::listen(handle, backlog) == -1)
+			throw std::system_error(errno, std::generic_category(), "listen");
+		
+		return handle;
+	}
+}
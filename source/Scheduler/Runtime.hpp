@@ -0,0 +1,88 @@
+//
+//  Runtime.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Reactor.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+
+namespace Scheduler
+{
+	// Runs one thread per CPU, each pinned to its CPU with its own reactor, and shares nothing between them. Fibers never migrate, and cores only communicate by posting to each other's reactors, which doesn't take a lock (see `Mailbox`).
+	// Each thread is pinned before it creates its reactor, so the reactor, its fiber stacks, and anything else its fibers allocate are placed on the local NUMA node by the kernel's first touch policy.
+	// Connections can be spread between cores by giving each core its own listener (see `listen`), or by sharing one listener which each core registers with `Reactor::exclusive`.
+	class Runtime final
+	{
+	public:
+		// @returns the CPUs which the calling thread is allowed to run on.
+		static std::vector<int> available();
+		
+		// Start a core for each CPU. A CPU may be listed more than once. CPUs are only pinned on Linux.
+		// @throws std::system_error if a thread can't be pinned to its CPU.
+		Runtime(const std::vector<int> & cpus = available());
+		
+		// Waits for all fibers to complete, and then stops the threads.
+		~Runtime();
+		
+		Runtime(const Runtime &) = delete;
+		Runtime & operator=(const Runtime &) = delete;
+		
+		// The number of cores.
+		std::size_t size() const noexcept {return _cores.size();}
+		
+		// The index of the core running the calling thread. Must be called from a core.
+		static std::size_t current();
+		
+		// The reactor of the specified core. Only `post` and `resume` may be called on it from other threads.
+		Reactor & reactor(std::size_t core);
+		
+		// Run the function in a new fiber on the specified core. This is safe to call from any thread.
+		void spawn(std::size_t core, std::function<void()> function);
+		
+		// Run the function in a new fiber on every core, passing the index of the core.
+		void spawn_all(std::function<void(std::size_t core)> function);
+		
+		// Invoke the callable on the specified core, outside of any fiber. This is safe to call from any thread.
+		void post(std::size_t core, std::function<void()> callable);
+		
+		// Wait until all fibers have completed. Must not be called from a core.
+		void wait();
+		
+		// Open a non-blocking socket listening on the address, with SO_REUSEPORT, so that several sockets (e.g. one per core) can listen on the same address and the kernel spreads connections between them.
+		// @throws std::system_error if the socket can't be opened, bound or listened on.
+		static Handle listen(const struct sockaddr * address, socklen_t length, int backlog = SOMAXCONN);
+	
+	private:
+		struct Core;
+		
+		std::vector<std::unique_ptr<Core>> _cores;
+		
+		// The number of spawned fibers which haven't completed:
+		std::atomic<std::size_t> _outstanding{0};
+		
+		std::mutex _mutex;
+		std::condition_variable _condition;
+		
+		// The number of cores which have started, used only while starting:
+		std::size_t _started = 0;
+		
+		std::atomic<bool> _stopping{false};
+		
+		void finish();
+		void stop();
+	};
+}
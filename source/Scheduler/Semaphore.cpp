@@ -9,7 +9,7 @@
 #include "Semaphore.hpp"
 
 #include "Reactor.hpp"
-#include "Defer.hpp"
+#include "Deadline.hpp"
 
 #include <iostream>
 
@@ -17,69 +17,138 @@ namespace Scheduler
 {
 	Semaphore::~Semaphore()
 	{
-		while (!_waiting.empty()) {
-			broadcast();
+		// Waiting fibers must run before the semaphore goes away, so transfer to them regardless of the mode. Other waiters (e.g. coroutines) are resumed later, so they are cancelled, rather than trying to acquire the semaphore again:
+		while (auto waiter = _waiting.pop_front()) {
+			assert(Reactor::current);
+			
+			if (waiter->ready.fiber) {
+				Reactor::current->transfer(waiter->ready.fiber);
+			} else {
+				waiter->cancelled = true;
+				Reactor::current->ready(waiter->ready);
+			}
 		}
 	}
 	
 	bool Semaphore::acquire(const Timestamp * timeout)
 	{
 		while (_count == 0) {
-			if (!wait(timeout)) return false;
+			if (_mode == Mode::HANDOFF) {
+				Waiter waiter;
+				waiter.acquiring = true;
+				
+				auto signalled = suspend(waiter, timeout);
+				
+				// The unit was handed to us, even if the timeout also expired:
+				if (waiter.acquired) return true;
+				if (!signalled) return false;
+			}
+			else {
+				if (!wait(timeout)) {
+					// We may have been signalled as we gave up, so pass the wakeup on:
+					if (_count) signal();
+					
+					return false;
+				}
+			}
 		}
 		
 		_count -= 1;
 		return true;
 	}
 	
+	bool Semaphore::try_acquire(Waiter & waiter)
+	{
+		if (_count) {
+			_count -= 1;
+			return true;
+		}
+		
+		waiter.acquiring = true;
+		_waiting.push_back(waiter);
+		
+		return false;
+	}
+	
 	void Semaphore::release()
 	{
+		if (_mode == Mode::HANDOFF) {
+			for (auto waiter = _waiting.front(); waiter; waiter = _waiting.next(waiter)) {
+				if (waiter->acquiring) {
+					waiter->unlink();
+					waiter->acquired = true;
+					
+					wake(waiter);
+					return;
+				}
+			}
+		}
+		
 		_count += 1;
 		signal();
 	}
 	
 	bool Semaphore::wait(const Timestamp * timeout)
+	{
+		Waiter waiter;
+		
+		return suspend(waiter, timeout);
+	}
+	
+	bool Semaphore::suspend(Waiter & waiter, const Timestamp * timeout)
 	{
 		Fiber * fiber = Fiber::current;
 		assert(fiber);
 		
-		auto iterator = _waiting.insert(_waiting.end(), fiber);
-		
-		auto defer_cleanup = Defer([&]{
-			_waiting.erase(iterator);
-		});
+		_waiting.push_back(waiter);
 		
 		assert(Reactor::current);
 		auto reactor = Reactor::current;
 		
 		if (timeout) {
-			return !reactor->sleep(fiber, *timeout);
+			// The sleep is interrupted if we are woken before the timeout:
+			if (reactor->sleep(fiber, *timeout)) return false;
+			
+			auto deadline = Deadline::current();
+			return !(deadline && deadline->expired());
 		}
 		else {
-			reactor->transfer();
-			return true;
+			return reactor->transfer();
 		}
 	}
 	
+	void Semaphore::wake(Waiter * waiter)
+	{
+		assert(Reactor::current);
+		
+		if (_mode == Mode::TRANSFER && waiter->ready.fiber)
+			Reactor::current->transfer(waiter->ready.fiber);
+		else
+			Reactor::current->ready(waiter->ready);
+	}
+	
 	void Semaphore::broadcast()
 	{
-		while (!_waiting.empty()) {
-			auto fiber = _waiting.front();
-			
-			assert(Reactor::current);
-			Reactor::current->transfer(fiber);
+		// Only wake the fibers which are waiting now, since woken fibers may wait again before this returns:
+		List<Waiter> waiting;
+		
+		while (auto waiter = _waiting.pop_front()) {
+			waiting.push_back(*waiter);
+		}
+		
+		while (auto waiter = waiting.pop_front()) {
+			wake(waiter);
 		}
 	}
 	
 	void Semaphore::signal(std::size_t count)
 	{
-		while (!_waiting.empty() && count) {
-			auto fiber = _waiting.front();
+		while (count) {
+			auto waiter = _waiting.pop_front();
+			if (!waiter) break;
 			
 			count -= 1;
-			
-			assert(Reactor::current);
-			Reactor::current->transfer(fiber);
+			wake(waiter);
 		}
 	}
 }
@@ -10,9 +10,10 @@
 
 #include <Time/Interval.hpp>
 #include "Fiber.hpp"
+#include "List.hpp"
+#include "Reactor.hpp"
 
 #include <cstdint>
-#include <list>
 
 namespace Scheduler
 {
@@ -20,11 +21,20 @@ namespace Scheduler
 	
 	class Semaphore final
 	{
-		std::size_t _count = 0;
-		std::list<Fiber *> _waiting;
-		
 	public:
-		Semaphore(std::size_t count = 1) : _count(count) {}
+		// How waiting fibers are woken.
+		enum class Mode {
+			// Transfer to each woken fiber immediately. The signalling fiber resumes once the woken fiber waits again.
+			TRANSFER,
+			
+			// Add woken fibers to the reactor's ready list, so the signalling fiber continues without a context switch. A woken fiber may still find the count taken by another fiber and wait again.
+			READY,
+			
+			// Like `READY`, but `release` gives the unit directly to the first fiber waiting to acquire it, so every wakeup succeeds.
+			HANDOFF,
+		};
+		
+		Semaphore(std::size_t count = 1, Mode mode = Mode::TRANSFER) : _count(count), _mode(mode) {}
 		~Semaphore();
 		
 		struct Acquire
@@ -36,18 +46,49 @@ namespace Scheduler
 		};
 		
 		std::size_t count() const noexcept {return _count;}
+		Mode mode() const noexcept {return _mode;}
 		
 		// @returns true if the semaphore was acquired.
-		// @returns false if timeout occurs.
+		// @returns false if timeout occurs, or the fiber's deadline expires.
 		bool acquire(const Timestamp * timeout = nullptr);
 		
 		void release();
 		
 		// @returns true if the semaphore was signalled.
-		// @returns false if timeout occurs.
+		// @returns false if timeout occurs, or the fiber's deadline expires.
 		bool wait(const Timestamp * timeout = nullptr);
 		
 		void broadcast();
 		void signal(std::size_t count = 1);
+		
+		// A waiting fiber, which lives on its stack, or another kind of waiter (e.g. a coroutine) whose `ready` has a callback.
+		struct Waiter : public Link {
+			Reactor::Ready ready;
+			
+			// Whether the fiber is waiting in `acquire`, and whether a unit was handed to it by `release`.
+			bool acquiring = false;
+			bool acquired = false;
+			
+			// Whether the semaphore was destroyed while the waiter was queued, in which case it must not be used again.
+			bool cancelled = false;
+			
+			~Waiter()
+			{
+				if (linked()) unlink();
+			}
+		};
+		
+		// Acquire the semaphore without suspending, or add the waiter to the queue. This is how waiters which aren't fibers (e.g. coroutines) acquire the semaphore: when the waiter is made ready, it has either been handed a unit (`acquired`), the semaphore was destroyed (`cancelled`), or it should try again.
+		// @returns true if the semaphore was acquired.
+		bool try_acquire(Waiter & waiter);
+	
+	private:
+		std::size_t _count = 0;
+		Mode _mode = Mode::TRANSFER;
+		
+		List<Waiter> _waiting;
+		
+		bool suspend(Waiter & waiter, const Timestamp * timeout);
+		void wake(Waiter * waiter);
 	};
 }
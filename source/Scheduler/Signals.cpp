@@ -0,0 +1,137 @@
+//
+//  Signals.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Signals.hpp"
+#include "Monitor.hpp"
+
+#include <cassert>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include <system_error>
+
+#if defined(SCHEDULER_EPOLL)
+	#include <sys/signalfd.h>
+#endif
+
+namespace Scheduler
+{
+	Signals::Signals(std::initializer_list<int> signals)
+	{
+		sigset_t mask;
+		sigemptyset(&mask);
+		
+		for (auto signal : signals) {
+			sigaddset(&mask, signal);
+		}
+		
+		if (auto result = ::pthread_sigmask(SIG_BLOCK, &mask, &_previous)) {
+			throw std::system_error(result, std::generic_category(), "pthread_sigmask");
+		}
+
+#if defined(SCHEDULER_EPOLL)
+		_handle = ::signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+		
+		if (!_handle) {
+			::pthread_sigmask(SIG_SETMASK, &_previous, nullptr);
+			throw std::system_error(errno, std::generic_category(), "signalfd");
+		}
+#elif defined(SCHEDULER_KQUEUE)
+		// A kqueue of its own, which becomes readable when a signal is recorded, and can be monitored like any other descriptor:
+		_handle = ::kqueue();
+		
+		if (!_handle) {
+			::pthread_sigmask(SIG_SETMASK, &_previous, nullptr);
+			throw std::system_error(errno, std::generic_category(), "kqueue");
+		}
+		
+		for (auto signal : signals) {
+			struct kevent change;
+			EV_SET(&change, signal, EVFILT_SIGNAL, EV_ADD, 0, 0, nullptr);
+			
+			if (::kevent(_handle, &change, 1, nullptr, 0, nullptr) == -1) {
+				::pthread_sigmask(SIG_SETMASK, &_previous, nullptr);
+				throw std::system_error(errno, std::generic_category(), "kevent");
+			}
+		}
+#endif
+	}
+	
+	Signals::~Signals()
+	{
+		_handle.close();
+		
+		::pthread_sigmask(SIG_SETMASK, &_previous, nullptr);
+	}
+	
+	int Signals::wait(const Timestamp * timeout)
+	{
+		while (_size == 0) {
+			if (read()) break;
+			
+			assert(Reactor::current);
+			
+			if (Reactor::current->wait(_handle, Monitor::READABLE, timeout) == 0) {
+				return 0;
+			}
+		}
+		
+		auto signal = _pending[_head];
+		
+		_head = (_head + 1) % BATCH;
+		_size -= 1;
+		
+		return signal;
+	}
+	
+	std::size_t Signals::read()
+	{
+		std::size_t count = 0;
+
+#if defined(SCHEDULER_EPOLL)
+		struct signalfd_siginfo information[BATCH];
+		
+		auto result = ::read(_handle, information, sizeof(information));
+		
+		if (result == -1) {
+			if (errno == EAGAIN || errno == EINTR) return 0;
+			
+			throw std::system_error(errno, std::generic_category(), "read");
+		}
+		
+		count = result / sizeof(struct signalfd_siginfo);
+		
+		for (std::size_t i = 0; i < count; i += 1) {
+			_pending[(_head + _size) % BATCH] = information[i].ssi_signo;
+			_size += 1;
+		}
+#elif defined(SCHEDULER_KQUEUE)
+		struct kevent events[BATCH];
+		struct timespec zero = {0, 0};
+		
+		auto result = ::kevent(_handle, nullptr, 0, events, BATCH, &zero);
+		
+		if (result == -1) {
+			if (errno == EINTR) return 0;
+			
+			throw std::system_error(errno, std::generic_category(), "kevent");
+		}
+		
+		count = result;
+		
+		// Each event is one signal, which may have been delivered several times since it was last read:
+		for (std::size_t i = 0; i < count; i += 1) {
+			_pending[(_head + _size) % BATCH] = events[i].ident;
+			_size += 1;
+		}
+#endif
+		
+		return count;
+	}
+}
@@ -0,0 +1,59 @@
+//
+//  Signals.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Reactor.hpp"
+#include "Handle.hpp"
+
+#include <array>
+#include <initializer_list>
+
+#include <signal.h>
+
+namespace Scheduler
+{
+	// Receives signals as readable events on the current reactor, using a signalfd on Linux or EVFILT_SIGNAL on kqueue. The signals are blocked for the calling thread, so they are only delivered through `wait`. Other threads inherit the signal mask when they are created, so signals should be set up before starting any threads.
+	class Signals final
+	{
+	public:
+		// Block the specified signals and start receiving them.
+		// @throws std::system_error if the signals can't be blocked or the descriptor can't be created.
+		Signals(std::initializer_list<int> signals);
+		
+		// Close the descriptor and restore the previous signal mask. Any signals which are still pending are delivered once they are unblocked.
+		~Signals();
+		
+		Signals(const Signals &) = delete;
+		Signals & operator=(const Signals &) = delete;
+		
+		const Handle & handle() const noexcept {return _handle;}
+		
+		// Wait for the next signal. Signals which are already queued are read in one batch, so they are returned without waiting again.
+		// @returns the signal number, or 0 if the timeout (or the fiber's deadline) expired.
+		int wait(const Timestamp * timeout = nullptr);
+		
+		// The signals which have been read, but not yet returned by `wait`.
+		std::size_t pending() const noexcept {return _size;}
+	
+	private:
+		enum : std::size_t {
+			BATCH = 16
+		};
+		
+		sigset_t _previous;
+		Handle _handle;
+		
+		std::array<int, BATCH> _pending;
+		std::size_t _head = 0, _size = 0;
+		
+		// Read all the signals which are queued, up to the size of the batch, without blocking.
+		// @returns the number of signals read.
+		std::size_t read();
+	};
+}
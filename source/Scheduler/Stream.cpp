@@ -0,0 +1,205 @@
+//
+//  Stream.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Stream.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <errno.h>
+
+#include <system_error>
+
+#include <sys/uio.h>
+
+namespace Scheduler
+{
+	Stream::Stream(Handle handle, std::size_t capacity) : _handle(std::move(handle)), _capacity(capacity), _input(capacity)
+	{
+		_output.reserve(capacity);
+	}
+	
+	std::size_t Stream::read(void * buffer, std::size_t size)
+	{
+		if (_start < _end) {
+			auto count = std::min(size, _end - _start);
+			
+			std::memcpy(buffer, _input.data() + _start, count);
+			_start += count;
+			
+			return count;
+		}
+		
+		// Fill the caller's buffer first, and read ahead with whatever else is available:
+		_start = _end = 0;
+		
+		struct iovec buffers[2] = {
+			{buffer, size},
+			{_input.data(), _input.size()},
+		};
+		
+		auto count = read_vectored(buffers, 2);
+		
+		if (count > size) {
+			_end = count - size;
+			return size;
+		}
+		
+		return count;
+	}
+	
+	std::optional<std::string_view> Stream::read_until(std::string_view delimiter, std::size_t limit)
+	{
+		// The offset from which to continue searching, since the delimiter may be split between reads:
+		std::size_t offset = 0;
+		
+		while (true) {
+			auto data = buffered();
+			auto index = data.find(delimiter, offset);
+			
+			if (index != std::string_view::npos && index <= limit) {
+				_start += index + delimiter.size();
+				
+				return data.substr(0, index);
+			}
+			
+			if (data.size() >= limit + delimiter.size())
+				throw std::system_error(EMSGSIZE, std::generic_category(), "read_until");
+			
+			if (data.size() >= delimiter.size()) {
+				offset = data.size() - delimiter.size() + 1;
+			}
+			
+			if (fill() == 0) return std::nullopt;
+		}
+	}
+	
+	std::optional<std::string_view> Stream::read_exactly(std::size_t size)
+	{
+		while (_end - _start < size) {
+			if (fill() == 0) return std::nullopt;
+		}
+		
+		auto data = buffered().substr(0, size);
+		_start += size;
+		
+		return data;
+	}
+	
+	void Stream::write(const void * data, std::size_t size)
+	{
+		auto bytes = static_cast<const char *>(data);
+		
+		if (_output.size() + size > _capacity) {
+			// Write the queued data and the new data with one system call, rather than copying the new data first. Once the queue is empty, any remainder which fits is queued:
+			while (!_output.empty() || size > _capacity) {
+				struct iovec buffers[2];
+				int count = 0;
+				
+				if (!_output.empty()) {
+					buffers[count++] = {_output.data(), _output.size()};
+				}
+				
+				buffers[count++] = {const_cast<char *>(bytes), size};
+				
+				auto written = write_vectored(buffers, count);
+				
+				if (written < _output.size()) {
+					consume(written);
+				} else {
+					written -= _output.size();
+					_output.clear();
+					
+					bytes += written;
+					size -= written;
+				}
+			}
+		}
+		
+		_output.insert(_output.end(), bytes, bytes + size);
+	}
+	
+	void Stream::flush()
+	{
+		while (!_output.empty()) {
+			struct iovec buffer = {_output.data(), _output.size()};
+			
+			consume(write_vectored(&buffer, 1));
+		}
+	}
+	
+	std::size_t Stream::fill()
+	{
+		if (_start == _end) {
+			_start = _end = 0;
+		}
+		
+		if (_end == _input.size()) {
+			// Compact the buffer if at least half of it has been consumed, otherwise grow it:
+			if (_start > 0 && _start >= _input.size() / 2) {
+				std::memmove(_input.data(), _input.data() + _start, _end - _start);
+				
+				_end -= _start;
+				_start = 0;
+			} else {
+				_input.resize(std::max(_input.size() * 2, std::size_t(CAPACITY)));
+			}
+		}
+		
+		struct iovec buffer = {_input.data() + _end, _input.size() - _end};
+		
+		auto count = read_vectored(&buffer, 1);
+		_end += count;
+		
+		return count;
+	}
+	
+	void Stream::wait(Monitor::Event event, const char * name)
+	{
+		assert(Reactor::current);
+		
+		// The wait only fails if the fiber's deadline expired:
+		if (Reactor::current->wait(_handle, event) == 0)
+			throw std::system_error(ETIMEDOUT, std::generic_category(), name);
+	}
+	
+	std::size_t Stream::read_vectored(struct iovec * buffers, int count)
+	{
+		while (true) {
+			auto result = ::readv(_handle, buffers, count);
+			
+			if (result != -1) return result;
+			
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				wait(Monitor::READABLE, "readv");
+			} else if (errno != EINTR) {
+				throw std::system_error(errno, std::generic_category(), "readv");
+			}
+		}
+	}
+	
+	std::size_t Stream::write_vectored(struct iovec * buffers, int count)
+	{
+		while (true) {
+			auto result = ::writev(_handle, buffers, count);
+			
+			if (result != -1) return result;
+			
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				wait(Monitor::WRITABLE, "writev");
+			} else if (errno != EINTR) {
+				throw std::system_error(errno, std::generic_category(), "writev");
+			}
+		}
+	}
+	
+	void Stream::consume(std::size_t size)
+	{
+		_output.erase(_output.begin(), _output.begin() + size);
+	}
+}
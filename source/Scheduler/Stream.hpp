@@ -0,0 +1,98 @@
+//
+//  Stream.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Handle.hpp"
+#include "Monitor.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+struct iovec;
+
+namespace Scheduler
+{
+	// A buffered stream over a non-blocking descriptor. Each operation tries the system call first, and only waits on the current reactor if it would block. Small writes are queued and written together with `writev`, and reads fill the caller's buffer and the read-ahead buffer with one `readv`.
+	// If the fiber is within a `Deadline` scope, waits which expire throw std::system_error with ETIMEDOUT.
+	class Stream final
+	{
+	public:
+		enum : std::size_t {
+			CAPACITY = 1024 * 16,
+		};
+		
+		// Take ownership of the descriptor. Writes are queued until `capacity` bytes are pending, and the read-ahead buffer starts at the same size.
+		Stream(Handle handle, std::size_t capacity = CAPACITY);
+		
+		// Queued writes are not flushed, since that may need to wait.
+		~Stream() = default;
+		
+		Stream(const Stream &) = delete;
+		Stream & operator=(const Stream &) = delete;
+		
+		const Handle & handle() const noexcept {return _handle;}
+		
+		// Read into the buffer, returning data which was read ahead without a system call if there is any.
+		// @returns the number of bytes read, which is 0 at the end of the stream.
+		// @throws std::system_error if the read fails.
+		std::size_t read(void * buffer, std::size_t size);
+		
+		// Read up to the delimiter, which is consumed but not included in the result. The result refers to the read-ahead buffer, and is valid until the next read.
+		// @returns the data, or nothing if the stream ended before the delimiter.
+		// @throws std::system_error with EMSGSIZE if the delimiter isn't found within `limit` bytes.
+		std::optional<std::string_view> read_until(std::string_view delimiter, std::size_t limit = CAPACITY);
+		
+		// Read exactly `size` bytes. The result refers to the read-ahead buffer, and is valid until the next read.
+		// @returns the data, or nothing if the stream ended first.
+		std::optional<std::string_view> read_exactly(std::size_t size);
+		
+		// The data which has been read ahead but not yet consumed.
+		std::string_view buffered() const noexcept {return std::string_view(_input.data() + _start, _end - _start);}
+		
+		// Queue the data, writing the queued data and this data together if the queue would exceed the capacity.
+		// @throws std::system_error if the write fails.
+		void write(const void * data, std::size_t size);
+		void write(std::string_view data) {write(data.data(), data.size());}
+		
+		// Write all queued data.
+		// @throws std::system_error if the write fails.
+		void flush();
+		
+		// The number of bytes which are queued for writing.
+		std::size_t pending() const noexcept {return _output.size();}
+	
+	private:
+		Handle _handle;
+		std::size_t _capacity;
+		
+		// The read-ahead buffer, where [_start, _end) has been read but not consumed:
+		std::vector<char> _input;
+		std::size_t _start = 0, _end = 0;
+		
+		std::vector<char> _output;
+		
+		// Read more data into the read-ahead buffer, compacting or growing it if it's full.
+		// @returns the number of bytes read, which is 0 at the end of the stream.
+		std::size_t fill();
+		
+		// Wait until the descriptor is ready, e.g. after EAGAIN.
+		void wait(Monitor::Event event, const char * name);
+		
+		// Read into the buffers, retrying if the read would block.
+		std::size_t read_vectored(struct iovec * buffers, int count);
+		
+		// Write from the buffers, retrying if the write would block. The write may be partial.
+		std::size_t write_vectored(struct iovec * buffers, int count);
+		
+		// Remove written bytes from the front of the queue.
+		void consume(std::size_t size);
+	};
+}
@@ -0,0 +1,377 @@
+//
+//  Task.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+// Coroutines are only available when compiling with C++20 (or later):
+#if defined(__cpp_impl_coroutine)
+
+#include "Reactor.hpp"
+#include "Monitor.hpp"
+#include "After.hpp"
+#include "Semaphore.hpp"
+
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <system_error>
+#include <utility>
+
+namespace Scheduler
+{
+	template <typename T = void>
+	class Task;
+	
+	namespace Coroutine
+	{
+		// Resume the coroutine whose address is the context, from the reactor's ready list.
+		inline void resume(void * context)
+		{
+			std::coroutine_handle<>::from_address(context).resume();
+		}
+		
+		// Make the ready node resume the coroutine, rather than a fiber.
+		inline void prepare(Reactor::Ready & ready, std::coroutine_handle<> handle) noexcept
+		{
+			ready.fiber = nullptr;
+			ready.callback = &resume;
+			ready.context = handle.address();
+		}
+		
+		struct PromiseBase
+		{
+			// The coroutine awaiting this one, if any:
+			std::coroutine_handle<> continuation;
+			
+			// The fiber waiting for this coroutine, if any:
+			Reactor::Ready * waiter = nullptr;
+			
+			std::exception_ptr exception;
+			
+			// Whether the coroutine destroys itself when it completes:
+			bool detached = false;
+			
+			std::suspend_always initial_suspend() noexcept {return {};}
+			
+			struct FinalAwaiter
+			{
+				bool await_ready() noexcept {return false;}
+				
+				template <typename Promise>
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+				{
+					auto & promise = handle.promise();
+					
+					if (promise.continuation) return promise.continuation;
+					
+					if (promise.waiter) {
+						assert(Reactor::current);
+						Reactor::current->ready(*promise.waiter);
+					}
+					
+					if (promise.detached) handle.destroy();
+					
+					return std::noop_coroutine();
+				}
+				
+				void await_resume() noexcept {}
+			};
+			
+			FinalAwaiter final_suspend() noexcept {return {};}
+			
+			void unhandled_exception()
+			{
+				// Nothing could observe the exception:
+				if (detached) std::terminate();
+				
+				exception = std::current_exception();
+			}
+		};
+		
+		template <typename T>
+		struct Promise : public PromiseBase
+		{
+			std::optional<T> value;
+			
+			Task<T> get_return_object() noexcept;
+			
+			void return_value(T result) {value.emplace(std::move(result));}
+			
+			T result()
+			{
+				if (exception) std::rethrow_exception(exception);
+				
+				return std::move(*value);
+			}
+		};
+		
+		template <>
+		struct Promise<void> : public PromiseBase
+		{
+			Task<void> get_return_object() noexcept;
+			
+			void return_void() noexcept {}
+			
+			void result()
+			{
+				if (exception) std::rethrow_exception(exception);
+			}
+		};
+	}
+	
+	// A stackless coroutine which runs on the current reactor. It only needs a frame for its own locals, rather than a whole fiber stack, so it suits large numbers of mostly idle waiters. Coroutines and fibers can share a reactor, and wait on the same monitors, timers and semaphores.
+	// A task starts when it's awaited (by another coroutine), waited on (by a fiber) or detached. Destroying a task which hasn't completed destroys its coroutine, which stops waiting.
+	// Coroutines are resumed on the reactor's stack, so they must not call functions which suspend a fiber, and `Deadline` scopes don't apply to them.
+	template <typename T>
+	class Task final
+	{
+	public:
+		using promise_type = Coroutine::Promise<T>;
+		using CoroutineHandle = std::coroutine_handle<promise_type>;
+		
+		explicit Task(CoroutineHandle handle) noexcept : _handle(handle) {}
+		
+		Task(Task && other) noexcept : _handle(std::exchange(other._handle, nullptr)) {}
+		
+		Task & operator=(Task && other) noexcept
+		{
+			if (this != &other) {
+				if (_handle) _handle.destroy();
+				_handle = std::exchange(other._handle, nullptr);
+			}
+			
+			return *this;
+		}
+		
+		~Task()
+		{
+			if (_handle) _handle.destroy();
+		}
+		
+		Task(const Task &) = delete;
+		Task & operator=(const Task &) = delete;
+		
+		bool done() const noexcept {return !_handle || _handle.done();}
+		
+		// Await the task from another coroutine, which is resumed directly when the task completes.
+		auto operator co_await() && noexcept
+		{
+			struct Awaiter
+			{
+				CoroutineHandle handle;
+				
+				bool await_ready() noexcept {return handle.done();}
+				
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+				{
+					handle.promise().continuation = continuation;
+					
+					return handle;
+				}
+				
+				T await_resume() {return handle.promise().result();}
+			};
+			
+			return Awaiter{_handle};
+		}
+		
+		// Run the task from a fiber, which is suspended until the task completes.
+		// @returns the result of the task, or rethrows its exception.
+		// @throws std::system_error with ETIMEDOUT if the fiber's deadline expires first, in which case the task is destroyed.
+		T wait()
+		{
+			assert(Reactor::current);
+			
+			auto & promise = _handle.promise();
+			
+			Reactor::Ready ready;
+			promise.waiter = &ready;
+			
+			if (!_handle.done()) _handle.resume();
+			
+			while (!_handle.done()) {
+				if (!Reactor::current->transfer()) {
+					_handle.destroy();
+					_handle = nullptr;
+					
+					throw std::system_error(ETIMEDOUT, std::generic_category(), "wait");
+				}
+			}
+			
+			promise.waiter = nullptr;
+			
+			return promise.result();
+		}
+		
+		// Start the task without waiting for it. It destroys itself when it completes, and terminates the program if it fails.
+		void detach() &&
+		{
+			auto handle = std::exchange(_handle, nullptr);
+			
+			handle.promise().detached = true;
+			handle.resume();
+		}
+	
+	private:
+		CoroutineHandle _handle;
+	};
+	
+	template <typename T>
+	Task<T> Coroutine::Promise<T>::get_return_object() noexcept
+	{
+		return Task<T>(Task<T>::CoroutineHandle::from_promise(*this));
+	}
+	
+	inline Task<void> Coroutine::Promise<void>::get_return_object() noexcept
+	{
+		return Task<void>(Task<void>::CoroutineHandle::from_promise(*this));
+	}
+	
+	// Wait for the events on the descriptor, e.g. `co_await monitor.readable()`.
+	// @returns the events which occurred, or `Monitor::NONE` if the timeout expired.
+	inline auto operator co_await(Monitor::Readiness readiness) noexcept
+	{
+		struct Awaiter
+		{
+			Monitor::Readiness readiness;
+			Reactor * reactor = Reactor::current;
+			Reactor::Registration registration{0, nullptr};
+			bool watching = false;
+			
+			bool await_ready()
+			{
+				assert(reactor);
+				
+				if (auto events = reactor->watch(readiness.descriptor, readiness.events, registration)) {
+					registration.result = events;
+					return true;
+				}
+				
+				watching = true;
+				
+				return false;
+			}
+			
+			void await_suspend(std::coroutine_handle<> handle)
+			{
+				Coroutine::prepare(registration, handle);
+				reactor->add_waiting();
+				
+				if (readiness.timeout) {
+					registration.schedule(*reactor, *readiness.timeout, reactor->slack());
+				}
+			}
+			
+			Monitor::Event await_resume() noexcept
+			{
+				return Monitor::Event(registration.result);
+			}
+			
+			~Awaiter()
+			{
+				if (watching) {
+					reactor->unwatch(readiness.descriptor, registration);
+					reactor->remove_waiting();
+				}
+			}
+		};
+		
+		return Awaiter{readiness};
+	}
+	
+	// Sleep for the duration, e.g. `co_await After(duration)`.
+	inline auto operator co_await(const After & after) noexcept
+	{
+		struct Awaiter
+		{
+			const After & after;
+			Reactor::Registration registration{-1, nullptr};
+			Reactor * reactor = nullptr;
+			
+			bool await_ready() noexcept {return false;}
+			
+			void await_suspend(std::coroutine_handle<> handle)
+			{
+				reactor = Reactor::current;
+				assert(reactor);
+				
+				Coroutine::prepare(registration, handle);
+				registration.schedule(*reactor, after.duration(), after.slack() ? *after.slack() : reactor->slack());
+				
+				reactor->add_waiting();
+			}
+			
+			void await_resume() noexcept {}
+			
+			~Awaiter()
+			{
+				if (reactor) reactor->remove_waiting();
+			}
+		};
+		
+		return Awaiter{after};
+	}
+	
+	// Acquire the semaphore, e.g. `co_await semaphore`. It should be released with `release`.
+	// @throws std::system_error with ECANCELED if the semaphore is destroyed while waiting.
+	inline auto operator co_await(Semaphore & semaphore) noexcept
+	{
+		struct Awaiter
+		{
+			Semaphore & semaphore;
+			Semaphore::Waiter waiter{};
+			std::coroutine_handle<> handle{};
+			Reactor * reactor = nullptr;
+			
+			// Invoked when the waiter is made ready. If the unit wasn't handed to us, another waiter may have taken it first, in which case we wait again:
+			static void wake(void * context)
+			{
+				auto awaiter = static_cast<Awaiter *>(context);
+				
+				if (awaiter->waiter.cancelled || awaiter->waiter.acquired || awaiter->semaphore.try_acquire(awaiter->waiter)) {
+					awaiter->handle.resume();
+				}
+			}
+			
+			bool await_ready() noexcept {return false;}
+			
+			bool await_suspend(std::coroutine_handle<> handle_)
+			{
+				handle = handle_;
+				
+				waiter.ready.fiber = nullptr;
+				waiter.ready.callback = &wake;
+				waiter.ready.context = this;
+				
+				if (semaphore.try_acquire(waiter)) return false;
+				
+				reactor = Reactor::current;
+				assert(reactor);
+				reactor->add_waiting();
+				
+				return true;
+			}
+			
+			void await_resume()
+			{
+				if (waiter.cancelled)
+					throw std::system_error(ECANCELED, std::generic_category(), "acquire");
+			}
+			
+			~Awaiter()
+			{
+				if (reactor) reactor->remove_waiting();
+			}
+		};
+		
+		return Awaiter{semaphore};
+	}
+}
+
+#endif
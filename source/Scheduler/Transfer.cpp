@@ -0,0 +1,179 @@
+//
+//  Transfer.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Transfer.hpp"
+#include "Reactor.hpp"
+#include "Monitor.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <system_error>
+
+#if defined(SCHEDULER_EPOLL)
+	#include <sys/sendfile.h>
+	#include <sys/stat.h>
+#else
+	#include "IO.hpp"
+#endif
+
+namespace Scheduler
+{
+	enum : std::size_t {
+		// The most which is moved by each system call:
+		CHUNK = 1024 * 256,
+	};
+
+#if defined(SCHEDULER_EPOLL)
+	static void wait(Descriptor descriptor, Monitor::Event event, const char * name)
+	{
+		assert(Reactor::current);
+		
+		// The wait only fails if the fiber's deadline expired:
+		if (Reactor::current->wait(descriptor, event) == 0)
+			throw std::system_error(ETIMEDOUT, std::generic_category(), name);
+	}
+	
+	namespace
+	{
+		// The pipe which data is spliced through.
+		struct Buffer
+		{
+			Descriptor input = -1, output = -1;
+			
+			Buffer()
+			{
+				Descriptor descriptors[2];
+				
+				if (::pipe2(descriptors, O_NONBLOCK | O_CLOEXEC) == -1)
+					throw std::system_error(errno, std::generic_category(), "pipe2");
+				
+				input = descriptors[0];
+				output = descriptors[1];
+				
+				// A bigger pipe moves more data per system call. The default size still works, so failure is ignored:
+				::fcntl(output, F_SETPIPE_SZ, int(CHUNK));
+			}
+			
+			~Buffer()
+			{
+				::close(input);
+				::close(output);
+			}
+			
+			Buffer(const Buffer &) = delete;
+			Buffer & operator=(const Buffer &) = delete;
+		};
+		
+		// An empty pipe which can be reused by the next transfer on this thread:
+		thread_local std::unique_ptr<Buffer> spare;
+	}
+	
+	static std::size_t send_file(Descriptor from, Descriptor to, std::size_t length)
+	{
+		std::size_t moved = 0;
+		
+		while (moved < length) {
+			auto result = ::sendfile(to, from, nullptr, std::min<std::size_t>(length - moved, CHUNK));
+			
+			if (result > 0) {
+				moved += result;
+			} else if (result == 0) {
+				break;
+			} else if (errno == EAGAIN) {
+				wait(to, Monitor::WRITABLE, "sendfile");
+			} else if (errno != EINTR) {
+				throw std::system_error(errno, std::generic_category(), "sendfile");
+			}
+		}
+		
+		return moved;
+	}
+	
+	static std::size_t splice(Descriptor from, Descriptor to, std::size_t length)
+	{
+		// If the transfer fails, the pipe may still contain data, so it's only reused once it has been drained:
+		auto buffer = spare ? std::move(spare) : std::make_unique<Buffer>();
+		
+		std::size_t moved = 0;
+		
+		while (moved < length) {
+			auto result = ::splice(from, nullptr, buffer->output, nullptr, std::min<std::size_t>(length - moved, CHUNK), SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+			
+			if (result == 0) break;
+			
+			if (result == -1) {
+				if (errno == EAGAIN) {
+					// The pipe is empty, so it must be the source which would block:
+					wait(from, Monitor::READABLE, "splice");
+				} else if (errno != EINTR) {
+					throw std::system_error(errno, std::generic_category(), "splice");
+				}
+				
+				continue;
+			}
+			
+			std::size_t buffered = result;
+			
+			while (buffered > 0) {
+				auto result = ::splice(buffer->input, nullptr, to, nullptr, buffered, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+				
+				if (result > 0) {
+					buffered -= result;
+					moved += result;
+				} else if (result == -1 && errno == EAGAIN) {
+					wait(to, Monitor::WRITABLE, "splice");
+				} else if (result == -1 && errno != EINTR) {
+					throw std::system_error(errno, std::generic_category(), "splice");
+				}
+			}
+		}
+		
+		spare = std::move(buffer);
+		
+		return moved;
+	}
+	
+	std::size_t transfer(Descriptor from, Descriptor to, std::size_t length)
+	{
+		struct stat status;
+		
+		if (::fstat(from, &status) == -1)
+			throw std::system_error(errno, std::generic_category(), "fstat");
+		
+		if (S_ISREG(status.st_mode)) {
+			return send_file(from, to, length);
+		} else {
+			return splice(from, to, length);
+		}
+	}
+#else
+	std::size_t transfer(Descriptor from, Descriptor to, std::size_t length)
+	{
+		char buffer[1024 * 16];
+		std::size_t moved = 0;
+		
+		while (moved < length) {
+			auto size = IO::read(from, buffer, std::min(length - moved, sizeof(buffer)));
+			if (size == 0) break;
+			
+			for (std::size_t offset = 0; offset < size;) {
+				offset += IO::write(to, buffer + offset, size - offset);
+			}
+			
+			moved += size;
+		}
+		
+		return moved;
+	}
+#endif
+}
@@ -0,0 +1,23 @@
+//
+//  Transfer.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Handle.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Scheduler
+{
+	// Move up to `length` bytes from one descriptor to another, suspending the current fiber while either side would block. On Linux, the data doesn't pass through user space: regular files are sent with `sendfile`, and anything else is spliced through a pipe which is kept for each thread. Otherwise, the data is copied through a buffer.
+	// Both descriptors should be non-blocking, except for regular files. Data is read from the current offset of `from`, which is advanced.
+	// @returns the number of bytes moved, which is less than `length` if `from` reached the end of the stream.
+	// @throws std::system_error if either side fails, or with ETIMEDOUT if the fiber's deadline expires.
+	std::size_t transfer(Descriptor from, Descriptor to, std::size_t length = SIZE_MAX);
+}
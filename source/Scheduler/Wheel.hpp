@@ -0,0 +1,366 @@
+//
+//  Wheel.hpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "List.hpp"
+#include "Histogram.hpp"
+
+#include <Time/Interval.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+namespace Scheduler
+{
+	using Time::Timestamp;
+	using Time::Duration;
+	
+	// A hierarchical timing wheel, with the same interface as Time::Queue. Scheduling and cancelling an event is O(1), and cancelled events are removed immediately rather than remaining in the queue until they expire.
+	// Events are rounded up to the resolution of the wheel, so they never fire early.
+	template <typename HandleT>
+	class Wheel final
+	{
+	public:
+		enum : std::uint64_t {
+			BITS = 6,
+			SLOTS = 1 << BITS,
+			MASK = SLOTS - 1,
+			LEVELS = 6,
+			
+			// Events further in the future than this are clamped:
+			HORIZON = std::uint64_t(1) << (BITS * LEVELS),
+		};
+		
+		struct Event : public Link {
+			Event() {}
+			
+			std::uint64_t deadline = 0;
+			HandleT handle;
+			
+			// Incremented every time the event is removed from the wheel, so that stale references can be detected.
+			std::uint32_t generation = 0;
+			
+			std::uint8_t level = 0, slot = 0;
+			
+			// Whether the deadline was deferred so that it could fire with other events.
+			bool deferred = false;
+		};
+		
+		// A reference to a scheduled event. It becomes false once the event has fired or been cancelled.
+		class EventReference
+		{
+			Wheel * _wheel = nullptr;
+			Event * _event = nullptr;
+			std::uint32_t _generation = 0;
+		
+		public:
+			EventReference() {}
+			EventReference(Wheel * wheel, Event * event) : _wheel(wheel), _event(event), _generation(event->generation) {}
+			
+			explicit operator bool() const noexcept {return _event && _event->generation == _generation;}
+			
+			Event * operator->() const noexcept {return _event;}
+			Event & operator*() const noexcept {return *_event;}
+			
+			// Remove the event from the wheel, if it is still scheduled.
+			void cancel()
+			{
+				if (*this) _wheel->remove(_event);
+				
+				_event = nullptr;
+			}
+		};
+		
+		Wheel(const Duration & resolution = Duration(0.001)) : _epoch(Clock::now())
+		{
+			_resolution = std::chrono::nanoseconds(nanoseconds(resolution));
+			if (_resolution.count() <= 0) _resolution = std::chrono::nanoseconds(1);
+		}
+		
+		Wheel(const Wheel &) = delete;
+		Wheel & operator=(const Wheel &) = delete;
+		
+		Timestamp now() const
+		{
+			return Duration(std::chrono::duration<double>(Clock::now().time_since_epoch()).count());
+		}
+		
+		Duration resolution() const noexcept
+		{
+			return Duration(std::chrono::duration<double>(_resolution).count());
+		}
+		
+		// The number of events which are scheduled.
+		std::size_t size() const noexcept {return _size;}
+		
+		// The number of wakeups which were avoided by deferring events within their slack.
+		std::size_t coalesced() const noexcept {return _coalesced;}
+		
+		// Record how late each event fires (in nanoseconds, relative to the tick it was scheduled for) into the histogram, or stop recording if null.
+		void set_lateness(Histogram * lateness) noexcept {_lateness = lateness;}
+		
+		// Schedule the handle to be invoked after the specified timeout. The event may be deferred by up to `slack`, so that events with nearby deadlines fire together.
+		EventReference schedule(const Timestamp & timeout, HandleT handle, const Duration & slack = Duration(0))
+		{
+			Event * event = allocate();
+			
+			arm(event, timeout, handle, slack);
+			
+			return EventReference(this, event);
+		}
+		
+		// Schedule the handle again. If the event is still scheduled, it's moved in place, otherwise the most recently released event is reused, which is usually the one which just fired.
+		void reschedule(EventReference & reference, const Timestamp & timeout, HandleT handle, const Duration & slack = Duration(0))
+		{
+			if (reference) {
+				unlink(&*reference);
+				arm(&*reference, timeout, handle, slack);
+			} else {
+				reference = schedule(timeout, handle, slack);
+			}
+		}
+		
+		// Invoke the handles of all events which have expired.
+		void run()
+		{
+			auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _epoch);
+			auto target = std::uint64_t(elapsed / _resolution);
+			
+			while (_current < target) {
+				if (_size == 0) {
+					_current = target;
+					break;
+				}
+				
+				// Skip ahead to whichever comes first: the next occupied slot, the next time the upper levels must be cascaded, or the target:
+				std::uint64_t step = SLOTS - (_current & MASK);
+				
+				if (auto distance = next(0, _current)) {
+					if (distance < step) step = distance;
+				}
+				
+				if (target - _current < step) step = target - _current;
+				
+				_current += step;
+				
+				if ((_current & MASK) == 0) {
+					cascade(1);
+				}
+				
+				auto & slot = _slots[0][_current & MASK];
+				
+				// Without slack, each deferred event would have needed its own wakeup, in addition to one for any event which was due at this tick:
+				std::size_t deferred = 0, fired = 0;
+				
+				while (auto event = slot.pop_front()) {
+					HandleT handle = event->handle;
+					
+					fired += 1;
+					if (event->deferred) deferred += 1;
+					
+					if (_lateness) {
+						auto deadline = std::int64_t(event->deadline) * _resolution.count();
+						_lateness->record(elapsed.count() > deadline ? elapsed.count() - deadline : 0);
+					}
+					
+					release(event);
+					
+					if (handle) handle();
+				}
+				
+				if (deferred) {
+					_coalesced += (deferred == fired) ? deferred - 1 : deferred;
+				}
+				
+				_occupied[0] &= ~(std::uint64_t(1) << (_current & MASK));
+			}
+		}
+		
+		// @returns the time until the next event expires, or an earlier time at which the wheel must be cascaded.
+		std::optional<Timestamp> next_timestamp() const
+		{
+			if (_size == 0) return std::nullopt;
+			
+			std::uint64_t deadline = HORIZON + _current;
+			
+			for (std::size_t level = 0; level < LEVELS; level += 1) {
+				auto block = _current >> (BITS * level);
+				
+				if (auto distance = next(level, block)) {
+					auto tick = (block + distance) << (BITS * level);
+					if (tick < deadline) deadline = tick;
+				}
+			}
+			
+			auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _epoch);
+			auto remaining = std::chrono::nanoseconds(deadline * _resolution.count()) - elapsed;
+			
+			if (remaining.count() < 0) remaining = std::chrono::nanoseconds(0);
+			
+			return Duration(std::chrono::duration<double>(remaining).count());
+		}
+	
+	private:
+		using Clock = std::chrono::steady_clock;
+		
+		Clock::time_point _epoch;
+		std::chrono::nanoseconds _resolution;
+		
+		// The last tick which was processed.
+		std::uint64_t _current = 0;
+		std::size_t _size = 0;
+		std::size_t _coalesced = 0;
+		
+		Histogram * _lateness = nullptr;
+		
+		List<Event> _slots[LEVELS][SLOTS];
+		std::uint64_t _occupied[LEVELS] = {0};
+		
+		// Events are recycled, so scheduling only allocates when the number of events grows.
+		std::deque<Event> _events;
+		List<Event> _available;
+		
+		static std::int64_t nanoseconds(const Duration & duration)
+		{
+			auto timespec = duration.as_timespec();
+			
+			return std::int64_t(timespec.tv_sec) * 1000000000 + timespec.tv_nsec;
+		}
+		
+		// @returns the number of blocks from `block` to the next occupied slot in the level, or 0 if the level is empty.
+		std::uint64_t next(std::size_t level, std::uint64_t block) const
+		{
+			auto occupied = _occupied[level];
+			if (occupied == 0) return 0;
+			
+			// Rotate so that bit 0 corresponds to the slot after the current one:
+			auto shift = (block + 1) & MASK;
+			auto rotated = shift ? (occupied >> shift) | (occupied << (SLOTS - shift)) : occupied;
+			
+			return __builtin_ctzll(rotated) + 1;
+		}
+		
+		void insert(Event * event)
+		{
+			auto delta = event->deadline - _current;
+			
+			if (delta >= HORIZON) {
+				event->deadline = _current + HORIZON - 1;
+				delta = HORIZON - 1;
+			}
+			
+			std::size_t level = 0;
+			
+			while (delta >= (std::uint64_t(1) << (BITS * (level + 1)))) {
+				level += 1;
+			}
+			
+			auto slot = (event->deadline >> (BITS * level)) & MASK;
+			
+			event->level = level;
+			event->slot = slot;
+			
+			_slots[level][slot].push_back(*event);
+			_occupied[level] |= std::uint64_t(1) << slot;
+		}
+		
+		// Move the events from the current slot of the level into lower levels.
+		void cascade(std::size_t level)
+		{
+			if (level >= LEVELS) return;
+			
+			auto index = (_current >> (BITS * level)) & MASK;
+			
+			if (index == 0) {
+				cascade(level + 1);
+			}
+			
+			auto & slot = _slots[level][index];
+			_occupied[level] &= ~(std::uint64_t(1) << index);
+			
+			List<Event> events;
+			
+			while (auto event = slot.pop_front()) {
+				events.push_back(*event);
+			}
+			
+			while (auto event = events.pop_front()) {
+				insert(event);
+			}
+		}
+		
+		void arm(Event * event, const Timestamp & timeout, HandleT handle, const Duration & slack)
+		{
+			auto delay = nanoseconds(timeout);
+			if (delay < 0) delay = 0;
+			
+			// Round up to the next tick, so that events never fire early:
+			auto elapsed = Clock::now() - _epoch;
+			event->deadline = (elapsed.count() + delay + _resolution.count() - 1) / _resolution.count();
+			
+			// The current tick has already been processed:
+			if (event->deadline <= _current) event->deadline = _current + 1;
+			
+			// Align the deadline to a multiple of the slack, so that all deadlines in the same window share a tick:
+			auto window = nanoseconds(slack) / _resolution.count();
+			
+			event->deferred = false;
+			
+			if (window > 1) {
+				auto deadline = (event->deadline + window - 1) / window * window;
+				
+				event->deferred = (deadline != event->deadline);
+				event->deadline = deadline;
+			}
+			
+			event->handle = handle;
+			insert(event);
+		}
+		
+		Event * allocate()
+		{
+			_size += 1;
+			
+			if (auto event = _available.pop_back()) {
+				return event;
+			}
+			
+			return &_events.emplace_back();
+		}
+		
+		void release(Event * event)
+		{
+			_size -= 1;
+			
+			event->generation += 1;
+			event->handle = HandleT();
+			event->deferred = false;
+			
+			_available.push_back(*event);
+		}
+		
+		// Remove the event from its slot, without releasing it.
+		void unlink(Event * event)
+		{
+			event->unlink();
+			
+			if (_slots[event->level][event->slot].empty()) {
+				_occupied[event->level] &= ~(std::uint64_t(1) << event->slot);
+			}
+		}
+		
+		void remove(Event * event)
+		{
+			unlink(event);
+			release(event);
+		}
+	};
+}
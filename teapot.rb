@@ -43,6 +43,34 @@ define_target 'scheduler-test' do |target|
 	end
 end
 
+# The coroutines in `Task.hpp` are only compiled with C++20, so their tests are built separately:
+define_target 'scheduler-test-coroutines' do |target|
+	target.depends 'Library/Scheduler'
+	target.depends 'Library/UnitTest'
+	
+	target.depends 'Language/C++20'
+	
+	target.provides 'Test/Scheduler/Coroutines' do |arguments|
+		test_root = target.package.path + 'test'
+		
+		run tests: 'Scheduler-coroutines-tests', source_files: [test_root + 'Scheduler/Task.cpp', test_root + 'Scheduler/Pipe.cpp'], arguments: arguments
+	end
+end
+
+define_target 'scheduler-benchmark' do |target|
+	target.depends 'Library/Scheduler'
+	
+	target.depends 'Language/C++17'
+	
+	target.provides 'Benchmark/Scheduler' do |*arguments|
+		benchmark_root = target.package.path + 'benchmark'
+		
+		executable_path = build executable: 'Scheduler-benchmark', source_files: benchmark_root.glob('Scheduler/**/*.cpp')
+		
+		run executable_file: executable_path, arguments: arguments
+	end
+end
+
 # Configurations
 
 define_configuration 'development' do |configuration|
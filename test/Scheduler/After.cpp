@@ -13,6 +13,9 @@
 
 #include <unistd.h>
 
+#include <memory>
+#include <vector>
+
 namespace Scheduler
 {
 	UnitTest::Suite AfterTestSuite {
@@ -77,6 +80,30 @@ namespace Scheduler
 				
 				examiner.expect(count) == 3;
 			}
+		},
+		
+		{"it can coalesce timers within their slack",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				std::size_t count = 0;
+				
+				std::vector<std::unique_ptr<Fiber>> fibers;
+				
+				for (std::size_t i = 0; i < 10; i += 1) {
+					fibers.push_back(std::make_unique<Fiber>([&, i](){
+						After event(0.01 + i * 0.001, 0.05);
+						event.wait();
+						count += 1;
+					}));
+					
+					fibers.back()->transfer();
+				}
+				
+				bound.reactor.run();
+				
+				examiner.expect(count) == 10;
+				examiner.expect(bound.reactor.coalesced()) == 9;
+			}
 		}
 	};
 }
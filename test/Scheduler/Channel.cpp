@@ -0,0 +1,185 @@
+//
+//  Channel.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Channel.hpp>
+
+#include <vector>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite ChannelTestSuite {
+		"Scheduler::Channel",
+		
+		{"it can send and receive values in order",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Channel<int, 4> channel;
+				
+				std::vector<int> received;
+				
+				Fiber consumer([&](){
+					while (auto value = channel.receive()) {
+						received.push_back(*value);
+					}
+				});
+				
+				Fiber producer([&](){
+					for (int i = 0; i < 100; i += 1) {
+						channel.send(i);
+					}
+					
+					channel.close();
+				});
+				
+				consumer.transfer();
+				producer.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(received.size()) == 100;
+				
+				bool ordered = true;
+				for (int i = 0; i < int(received.size()); i += 1) {
+					if (received[i] != i) ordered = false;
+				}
+				
+				examiner.expect(ordered) == true;
+			}
+		},
+		
+		{"it hands values directly to a waiting receiver",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Channel<int, 4> channel;
+				
+				std::optional<int> value;
+				
+				Fiber consumer([&](){
+					value = channel.receive();
+				});
+				
+				consumer.transfer();
+				
+				Fiber producer([&](){
+					channel.send(42);
+					
+					// The value didn't go through the buffer:
+					examiner.expect(channel.size()) == 0;
+				});
+				
+				producer.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(value.value_or(0)) == 42;
+			}
+		},
+		
+		{"it can send and receive in batches",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Channel<int, 4> channel;
+				
+				std::vector<std::size_t> batches;
+				std::size_t sent = 0;
+				
+				Fiber consumer([&](){
+					int values[8];
+					
+					while (auto count = channel.receive_many(values, 8)) {
+						batches.push_back(count);
+					}
+				});
+				
+				Fiber producer([&](){
+					int values[20];
+					for (int i = 0; i < 20; i += 1) values[i] = i;
+					
+					sent = channel.send_many(values, 20);
+					channel.close();
+				});
+				
+				consumer.transfer();
+				producer.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(sent) == 20;
+				
+				std::size_t total = 0;
+				for (auto count : batches) total += count;
+				
+				examiner.expect(total) == 20;
+				
+				// Each wakeup drains several values, rather than one value per context switch:
+				examiner.expect(batches.size() < 10) == true;
+			}
+		},
+		
+		{"it can rendezvous without a buffer",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Channel<int, 0> channel;
+				
+				std::string order;
+				int value = 0;
+				
+				Fiber producer([&](){
+					order += 'A';
+					channel.send(7);
+					order += 'C';
+				});
+				
+				producer.transfer();
+				
+				Fiber consumer([&](){
+					order += 'B';
+					value = channel.receive().value_or(0);
+				});
+				
+				consumer.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(value) == 7;
+				examiner.expect(order) == "ABC";
+			}
+		},
+		
+		{"it wakes waiting fibers when closed",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Channel<int, 1> channel;
+				
+				bool received = true, sent = true;
+				
+				Fiber consumer([&](){
+					received = bool(channel.receive());
+				});
+				
+				consumer.transfer();
+				
+				Fiber closer([&](){
+					channel.close();
+				});
+				
+				closer.transfer();
+				
+				Fiber producer([&](){
+					sent = channel.send(1);
+				});
+				
+				producer.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(received) == false;
+				examiner.expect(sent) == false;
+			}
+		},
+	};
+}
@@ -0,0 +1,178 @@
+//
+//  Deadline.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Deadline.hpp>
+#include <Scheduler/Monitor.hpp>
+#include <Scheduler/Semaphore.hpp>
+#include <Scheduler/IO.hpp>
+
+#include "Pipe.hpp"
+
+#include <chrono>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	static double since(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+	
+	UnitTest::Suite DeadlineTestSuite {
+		"Scheduler::Deadline",
+		
+		{"it cancels every wait once it expires",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe pipe;
+				Semaphore semaphore(0);
+				
+				int events = -1;
+				bool acquired = true;
+				double elapsed = 0;
+				
+				Fiber fiber([&](){
+					auto start = std::chrono::steady_clock::now();
+					
+					Deadline deadline(0.01);
+					
+					Monitor monitor(pipe.input);
+					events = monitor.wait_readable();
+					
+					examiner.expect(deadline.expired()) == true;
+					
+					// The deadline has already expired, so this doesn't wait:
+					acquired = semaphore.acquire();
+					
+					elapsed = since(start);
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(events) == 0;
+				examiner.expect(acquired) == false;
+				examiner.expect(elapsed >= 0.01 && elapsed < 0.1) == true;
+			}
+		},
+		
+		{"it doesn't affect waits which complete in time",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				bool slept = false, expired = true;
+				
+				Fiber fiber([&](){
+					Deadline deadline(1.0);
+					
+					slept = bound.reactor.sleep(Fiber::current, 0.001);
+					expired = deadline.expired();
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(slept) == true;
+				examiner.expect(expired) == false;
+			}
+		},
+		
+		{"nested scopes use the earlier deadline",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				bool inner_expired = false, outer_expired = true;
+				double elapsed = 0;
+				
+				Fiber fiber([&](){
+					auto start = std::chrono::steady_clock::now();
+					
+					Deadline outer(0.01);
+					
+					{
+						Deadline inner(10.0);
+						
+						bound.reactor.sleep(Fiber::current, 10.0);
+						inner_expired = inner.expired();
+					}
+					
+					elapsed = since(start);
+				});
+				
+				fiber.transfer();
+				
+				Fiber other([&](){
+					Deadline outer(10.0);
+					
+					{
+						Deadline inner(0.01);
+						bound.reactor.sleep(Fiber::current, 10.0);
+					}
+					
+					// Only the inner deadline expired:
+					outer_expired = outer.expired();
+				});
+				
+				other.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(inner_expired) == true;
+				examiner.expect(elapsed < 0.1) == true;
+				examiner.expect(outer_expired) == false;
+			}
+		},
+		
+		{"it only applies to the fiber which created it",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				bool slept = false;
+				
+				Fiber fiber([&](){
+					Deadline deadline(0.001);
+					
+					bound.reactor.spawn([&](){
+						slept = bound.reactor.sleep(Fiber::current, 0.01);
+					});
+					
+					bound.reactor.sleep(Fiber::current, 1.0);
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(slept) == true;
+			}
+		},
+		
+		{"it fails blocking operations once it expires",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe pipe;
+				bool failed = false;
+				
+				Fiber fiber([&](){
+					Deadline deadline(0.01);
+					
+					char buffer[16];
+					
+					try {
+						IO::read(pipe.input, buffer, sizeof(buffer));
+					} catch (std::system_error &) {
+						failed = true;
+					}
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(failed) == true;
+			}
+		},
+	};
+}
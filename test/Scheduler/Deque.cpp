@@ -0,0 +1,79 @@
+//
+//  Deque.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Deque.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite DequeTestSuite {
+		"Scheduler::Deque",
+		
+		{"it pops from the bottom and steals from the top",
+			[](UnitTest::Examiner & examiner) {
+				Deque<int *> deque(2);
+				int values[4] = {0, 1, 2, 3};
+				
+				for (auto & value : values) deque.push(&value);
+				
+				examiner.expect(*deque.steal()) == 0;
+				examiner.expect(*deque.pop()) == 3;
+				examiner.expect(*deque.pop()) == 2;
+				examiner.expect(*deque.steal()) == 1;
+				examiner.expect(deque.pop() == nullptr) == true;
+				examiner.expect(deque.steal() == nullptr) == true;
+			}
+		},
+		
+		{"each item is taken exactly once",
+			[](UnitTest::Examiner & examiner) {
+				const std::size_t count = 100000;
+				
+				Deque<std::size_t *> deque;
+				std::vector<std::size_t> items(count);
+				std::vector<std::atomic<std::size_t>> taken(count);
+				
+				std::atomic<bool> done{false};
+				std::vector<std::thread> thieves;
+				
+				for (std::size_t i = 0; i < 3; i += 1) {
+					thieves.emplace_back([&]{
+						while (!done.load() || !deque.empty()) {
+							if (auto item = deque.steal()) taken[item - items.data()] += 1;
+						}
+					});
+				}
+				
+				for (std::size_t i = 0; i < count; i += 1) {
+					deque.push(&items[i]);
+					
+					if (i % 3 == 0) {
+						if (auto item = deque.pop()) taken[item - items.data()] += 1;
+					}
+				}
+				
+				while (auto item = deque.pop()) taken[item - items.data()] += 1;
+				
+				done = true;
+				for (auto & thief : thieves) thief.join();
+				
+				std::size_t once = 0;
+				for (auto & value : taken) if (value == 1) once += 1;
+				
+				examiner.expect(once) == count;
+			}
+		},
+	};
+}
@@ -0,0 +1,129 @@
+//
+//  FiberPool.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Reactor.hpp>
+#include <Scheduler/After.hpp>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite FiberPoolTestSuite {
+		"Scheduler::FiberPool",
+		
+		{"it reuses fibers",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				
+				std::size_t count = 0;
+				
+				for (std::size_t i = 0; i < 100; i += 1) {
+					reactor.spawn([&]{
+						count += 1;
+					});
+				}
+				
+				examiner.expect(count) == 100;
+				examiner.expect(reactor.fibers().size()) == 1;
+				examiner.expect(reactor.fibers().idle()) == 1;
+			}
+		},
+		
+		{"it can spawn fibers which wait",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				
+				std::string order;
+				
+				reactor.spawn([&]{
+					reactor.spawn([&]{
+						After(0.01).wait();
+						order += 'B';
+					});
+					
+					order += 'A';
+				});
+				
+				reactor.run();
+				
+				examiner.expect(order).to(be == "AB");
+				examiner.expect(reactor.fibers().size()) == 2;
+				examiner.expect(reactor.fibers().idle()) == 2;
+			}
+		},
+		
+		{"it counts the waits of each fiber",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				
+				reactor.set_metrics(true);
+				
+				std::uint64_t first = 0, second = 0;
+				
+				reactor.spawn([&]{
+					reactor.spawn([&]{
+						After(0.001).wait();
+						second = reactor.fibers().waits(Fiber::current);
+					});
+					
+					for (std::size_t i = 0; i < 3; i += 1) {
+						After(0.001).wait();
+					}
+					
+					first = reactor.fibers().waits(Fiber::current);
+				});
+				
+				reactor.run();
+				
+				examiner.expect(first) == 3;
+				examiner.expect(second) == 1;
+				examiner.expect(reactor.metrics().waits) == 4;
+			}
+		},
+		
+		{"it selects the smallest size class which fits",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				
+				reactor.spawn([]{}, 1024*64);
+				reactor.spawn([]{}, 1024*100);
+				reactor.spawn([]{}, 1024*200);
+				
+				examiner.expect(reactor.fibers().size()) == 2;
+			}
+		},
+		
+		{"it can trim idle stacks",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				
+				reactor.fibers().set_trim(FiberPool::Trim::DONTNEED);
+				
+				reactor.spawn([]{
+					char buffer[1024*256];
+					for (auto & value : buffer) ((volatile char &)value) = 1;
+				}, 1024*1024);
+				
+				examiner.expect(reactor.fibers().trim() > 1024*256) == true;
+				examiner.expect(reactor.fibers().trim()) == 0;
+				
+				std::size_t count = 0;
+				reactor.spawn([&]{count += 1;}, 1024*1024);
+				
+				examiner.expect(count) == 1;
+			}
+		},
+	};
+}
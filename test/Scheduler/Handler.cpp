@@ -0,0 +1,147 @@
+//
+//  Handler.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Handler.hpp>
+#include <Scheduler/Monitor.hpp>
+
+#include "Pipe.hpp"
+
+#include <unistd.h>
+#include <errno.h>
+
+#include <string>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite HandlerTestSuite {
+		"Scheduler::Handler",
+		
+		{"it can handle timers without a fiber",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				int count = 0, result = -1;
+				
+				Handler handler([&](int result_){
+					result = result_;
+					count += 1;
+					
+					if (count < 3) handler.after(bound.reactor, 0.001);
+				});
+				
+				handler.after(bound.reactor, 0.001);
+				examiner.expect(handler.armed()) == true;
+				
+				bound.reactor.run();
+				
+				examiner.expect(count) == 3;
+				examiner.expect(result) == 0;
+				examiner.expect(handler.armed()) == false;
+			}
+		},
+		
+		{"it is invoked when the descriptor is readable",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe pipe;
+				
+				std::string received;
+				int events = 0;
+				
+				Handler handler([&](int result){
+					char buffer[16];
+					events |= result;
+					
+					// Read until the pipe would block, since the reactor only reports new events:
+					while (true) {
+						auto size = ::read(pipe.input, buffer, sizeof(buffer));
+						
+						if (size > 0) {
+							received.append(buffer, size);
+						} else if (size == -1 && errno == EAGAIN) {
+							handler.watch(bound.reactor, pipe.input, Monitor::READABLE);
+							break;
+						} else {
+							break;
+						}
+					}
+				});
+				
+				handler.watch(bound.reactor, pipe.input, Monitor::READABLE);
+				
+				Fiber writer([&](){
+					for (auto message : {"Hello", " ", "World"}) {
+						bound.reactor.sleep(Fiber::current, 0.001);
+						::write(pipe.output, message, std::string(message).size());
+					}
+					
+					pipe.output.close();
+				});
+				
+				writer.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(received) == "Hello World";
+				examiner.expect(events & Monitor::READABLE) == Monitor::READABLE;
+			}
+		},
+		
+		{"it is invoked with 0 if the timeout expires first",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe pipe;
+				
+				int result = -1;
+				
+				Handler handler([&](int result_){
+					result = result_;
+				});
+				
+				Timestamp timeout(0.001);
+				handler.watch(bound.reactor, pipe.input, Monitor::READABLE, &timeout);
+				
+				bound.reactor.run();
+				
+				examiner.expect(result) == 0;
+			}
+		},
+		
+		{"it isn't invoked once it's cancelled",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				bool invoked = false;
+				
+				Handler handler([&](int){
+					invoked = true;
+				});
+				
+				handler.after(bound.reactor, 0.001);
+				handler.cancel();
+				
+				// Nothing is waiting, so this returns immediately:
+				bound.reactor.run();
+				
+				{
+					Handler destroyed([&](int){
+						invoked = true;
+					});
+					
+					destroyed.after(bound.reactor, 0.001);
+				}
+				
+				bound.reactor.run();
+				
+				examiner.expect(invoked) == false;
+				examiner.expect(bound.reactor.waiting()) == false;
+			}
+		},
+	};
+}
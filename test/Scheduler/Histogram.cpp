@@ -0,0 +1,69 @@
+//
+//  Histogram.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Histogram.hpp>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite HistogramTestSuite {
+		"Scheduler::Histogram",
+		
+		{"it records small values exactly",
+			[](UnitTest::Examiner & examiner) {
+				Histogram histogram;
+				
+				for (std::uint64_t value = 0; value < 10; value += 1) {
+					histogram.record(value);
+				}
+				
+				examiner.expect(histogram.count()) == 10;
+				examiner.expect(histogram.min()) == 0;
+				examiner.expect(histogram.max()) == 9;
+				examiner.expect(histogram.value_at(0.5)) == 5;
+			}
+		},
+		
+		{"it has bounded relative error",
+			[](UnitTest::Examiner & examiner) {
+				Histogram histogram;
+				
+				for (std::uint64_t value = 1; value <= 1000000; value += 1) {
+					histogram.record(value);
+				}
+				
+				for (double quantile : {0.5, 0.9, 0.99, 0.999}) {
+					double expected = quantile * 1000000;
+					double error = (histogram.value_at(quantile) - expected) / expected;
+					
+					examiner.expect(error >= 0 && error <= 1.0 / double(Histogram::SUB_BUCKETS)) == true;
+				}
+				
+				examiner.expect(histogram.value_at(1)) == 1000000;
+			}
+		},
+		
+		{"it can merge histograms",
+			[](UnitTest::Examiner & examiner) {
+				Histogram a, b;
+				
+				a.record(10);
+				b.record(1000);
+				
+				a.merge(b);
+				
+				examiner.expect(a.count()) == 2;
+				examiner.expect(a.min()) == 10;
+				examiner.expect(a.max()) == 1000;
+			}
+		},
+	};
+}
@@ -0,0 +1,153 @@
+//
+//  IO.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Fiber.hpp>
+#include <Scheduler/Reactor.hpp>
+#include <Scheduler/IO.hpp>
+#include "Pipe.hpp"
+
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/uio.h>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite IOTestSuite {
+		"Scheduler::IO",
+		
+		{"it can read and write",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto pipe = Pipe(true);
+				
+				std::string message;
+				
+				Fiber reader([&](){
+					char buffer[32];
+					
+					while (auto size = IO::read(pipe.input, buffer, sizeof(buffer))) {
+						message.append(buffer, size);
+						if (message.size() == 12) break;
+					}
+				});
+				
+				reader.transfer();
+				
+				Fiber writer([&](){
+					IO::write(pipe.output, "Hello ", 6);
+					IO::write(pipe.output, "World!", 6);
+				});
+				
+				writer.transfer();
+				
+				bound.reactor.run();
+				
+				examiner.expect(message).to(be == "Hello World!");
+			}
+		},
+		
+		{"it can accept and connect",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				
+				Handle server(::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0));
+				
+				struct sockaddr_in address = {};
+				address.sin_family = AF_INET;
+				address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+				socklen_t length = sizeof(address);
+				
+				::bind(server, reinterpret_cast<struct sockaddr *>(&address), length);
+				::getsockname(server, reinterpret_cast<struct sockaddr *>(&address), &length);
+				::listen(server, 1);
+				
+				char buffer[5] = {0};
+				
+				Fiber acceptor([&](){
+					Handle peer(IO::accept(server, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC));
+					
+					struct iovec vector = {buffer, sizeof(buffer)};
+					struct msghdr message = {};
+					message.msg_iov = &vector;
+					message.msg_iovlen = 1;
+					
+					IO::recvmsg(peer, &message);
+				});
+				
+				acceptor.transfer();
+				
+				Fiber connector([&](){
+					Handle client(::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0));
+					IO::connect(client, reinterpret_cast<struct sockaddr *>(&address), length);
+					
+					struct iovec vector = {const_cast<char *>("Hello"), 5};
+					struct msghdr message = {};
+					message.msg_iov = &vector;
+					message.msg_iovlen = 1;
+					
+					IO::sendmsg(client, &message);
+				});
+				
+				connector.transfer();
+				
+				bound.reactor.run();
+				
+				examiner.expect(std::string(buffer, 5)).to(be == "Hello");
+			}
+		},
+
+#if defined(SCHEDULER_URING)
+		{"it can read and write with registered buffers and files",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto pipe = Pipe(true);
+				
+				char input[32] = {0}, output[32] = "Hello World!";
+				
+				struct iovec buffers[2] = {
+					{input, sizeof(input)},
+					{output, sizeof(output)},
+				};
+				
+				Descriptor descriptors[2] = {pipe.input, pipe.output};
+				
+				// The reactor falls back to epoll if the ring isn't available:
+				if (!bound.reactor.register_buffers(buffers, 2)) {
+					examiner.expect(bound.reactor.completions()) == false;
+					return;
+				}
+				
+				examiner.expect(bound.reactor.register_files(descriptors, 2)) == true;
+				
+				std::size_t read = 0;
+				
+				Fiber reader([&](){
+					read = IO::read(IO::File(pipe.input, 0), input, sizeof(input), 0);
+				});
+				
+				reader.transfer();
+				
+				Fiber writer([&](){
+					IO::write(IO::File(pipe.output, 1), output, 12, 1);
+				});
+				
+				writer.transfer();
+				
+				bound.reactor.run();
+				
+				examiner.expect(read) == 12;
+				examiner.expect(std::string(input, read)) == "Hello World!";
+			}
+		},
+#endif
+	};
+}
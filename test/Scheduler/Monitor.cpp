@@ -13,6 +13,7 @@
 #include "Pipe.hpp"
 
 #include <unistd.h>
+#include <fcntl.h>
 
 #include <iostream>
 
@@ -65,5 +66,110 @@ namespace Scheduler
 				bound.reactor.run();
 			}
 		},
+		
+		{"it can wait for reading and writing on the same descriptor",
+			[](UnitTest::Examiner & examiner) {
+				std::string order;
+				
+				Reactor::Bound bound;
+				std::vector<char> buffer(1024);
+				
+				auto pipe = Pipe(true);
+				Monitor monitor(pipe.input);
+				
+				// Fill the buffer so that the descriptor is no longer writable:
+				while (::write(pipe.input, buffer.data(), buffer.size()) > 0);
+				
+				Fiber reader([&](){
+					monitor.wait_readable();
+					order += 'R';
+				});
+				
+				reader.transfer();
+				
+				Fiber writer([&](){
+					monitor.wait_writable();
+					order += 'W';
+				});
+				
+				writer.transfer();
+				
+				// Drain the buffer, making the input writable, and then make it readable:
+				while (::read(pipe.output, buffer.data(), buffer.size()) > 0);
+				::write(pipe.output, "Hello World!", 12);
+				
+				bound.reactor.run();
+				
+				examiner.expect(order.size()) == 2;
+			}
+		},
+		
+		{"it doesn't disturb other waiters when it's destroyed",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto pipe = Pipe(true);
+				
+				bool readable = false;
+				
+				Fiber reader([&](){
+					Monitor monitor(pipe.input);
+					
+					monitor.wait_readable();
+					readable = true;
+				});
+				
+				reader.transfer();
+				
+				Fiber writer([&](){
+					Monitor monitor(pipe.input);
+					
+					// The socket is already writable, so this doesn't block:
+					monitor.wait_writable();
+				});
+				
+				writer.transfer();
+				
+				::write(pipe.output, "Hello World!", 12);
+				
+				bound.reactor.run();
+				
+				examiner.expect(readable) == true;
+			}
+		},
+		
+		{"it can wait on a descriptor which was closed and reused",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				
+				int first[2], second[2];
+				examiner.expect(::pipe2(first, O_NONBLOCK | O_CLOEXEC)) == 0;
+				
+				int events = -1;
+				
+				Fiber fiber([&](){
+					Timestamp timeout(0.01);
+					Monitor(first[0]).wait_readable(&timeout);
+					
+					// Close the pipe without forgetting it, so that the reactor still has it registered:
+					::close(first[0]);
+					::close(first[1]);
+					
+					examiner.expect(::pipe2(second, O_NONBLOCK | O_CLOEXEC)) == 0;
+					examiner.expect(second[0]) == first[0];
+					
+					::write(second[1], "!", 1);
+					
+					timeout = Timestamp(0.2);
+					events = Monitor(second[0]).wait_readable(&timeout);
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				Handle input(second[0]), output(second[1]);
+				
+				examiner.expect(events) == Monitor::READABLE;
+			}
+		},
 	};
 }
@@ -0,0 +1,255 @@
+//
+//  Offload.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Offload.hpp>
+#include <Scheduler/Deadline.hpp>
+#include <Scheduler/Defer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite OffloadTestSuite {
+		"Scheduler::Offload",
+		
+		{"it runs the function on another thread",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Offload pool(1);
+				
+				std::thread::id id;
+				int result = 0;
+				
+				Fiber fiber([&](){
+					result = pool.run([&]{
+						id = std::this_thread::get_id();
+						return 42;
+					});
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(result) == 42;
+				examiner.expect(id != std::this_thread::get_id()) == true;
+			}
+		},
+		
+		{"it rethrows exceptions in the fiber",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				std::string message;
+				
+				Fiber fiber([&](){
+					try {
+						offload([]{throw std::runtime_error("failed");});
+					} catch (std::runtime_error & error) {
+						message = error.what();
+					}
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(message).to(be == "failed");
+			}
+		},
+		
+		{"other fibers keep running while the function blocks",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Offload pool(1);
+				std::string order;
+				
+				Fiber blocking([&](){
+					pool.run([]{
+						std::this_thread::sleep_for(std::chrono::milliseconds(50));
+					});
+					
+					order += 'B';
+				});
+				
+				blocking.transfer();
+				
+				Fiber ticking([&](){
+					for (std::size_t i = 0; i < 3; i += 1) {
+						bound.reactor.sleep(Fiber::current, 0.001);
+						order += 'T';
+					}
+				});
+				
+				ticking.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(order).to(be == "TTTB");
+			}
+		},
+		
+		{"it limits how many functions run at once",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Offload pool(2);
+				
+				std::atomic<std::size_t> running{0}, most{0};
+				
+				for (std::size_t i = 0; i < 6; i += 1) {
+					bound.reactor.spawn([&](){
+						pool.run([&]{
+							auto count = ++running;
+							if (count > most) most = count;
+							
+							std::this_thread::sleep_for(std::chrono::milliseconds(5));
+							running -= 1;
+						});
+					});
+				}
+				
+				bound.reactor.run();
+				
+				auto metrics = pool.metrics();
+				
+				examiner.expect(most <= 2) == true;
+				examiner.expect(metrics.threads) == 2;
+				examiner.expect(metrics.completed) == 6;
+				examiner.expect(metrics.max_queued >= 4) == true;
+			}
+		},
+		
+		{"it starts threads for a burst of functions",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Offload pool(4);
+				
+				// Start one thread, which is then idle:
+				bound.reactor.spawn([&](){
+					pool.run([]{});
+				});
+				
+				bound.reactor.run();
+				examiner.expect(pool.metrics().threads) == 1;
+				
+				std::atomic<std::size_t> running{0}, most{0};
+				
+				for (std::size_t i = 0; i < 4; i += 1) {
+					bound.reactor.spawn([&](){
+						pool.run([&]{
+							auto count = ++running;
+							if (count > most) most = count;
+							
+							std::this_thread::sleep_for(std::chrono::milliseconds(20));
+							running -= 1;
+						});
+					});
+				}
+				
+				bound.reactor.run();
+				
+				examiner.expect(pool.metrics().threads) == 4;
+				examiner.expect(most > 1) == true;
+			}
+		},
+		
+		{"it stops waiting when the deadline expires",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Offload pool(1);
+				bool timed_out = false;
+				
+				Fiber fiber([&](){
+					Deadline deadline(0.01);
+					
+					try {
+						pool.run([]{
+							std::this_thread::sleep_for(std::chrono::milliseconds(50));
+						});
+					} catch (std::system_error & error) {
+						timed_out = (error.code().value() == ETIMEDOUT);
+					}
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(timed_out) == true;
+			}
+		},
+		
+		{"it doesn't post to a reactor which stopped waiting",
+			[](UnitTest::Examiner & examiner) {
+				Offload pool(1);
+				
+				{
+					Reactor::Bound bound;
+					
+					Fiber fiber([&](){
+						Deadline deadline(0.001);
+						
+						try {
+							pool.run([]{
+								std::this_thread::sleep_for(std::chrono::milliseconds(20));
+							});
+						} catch (std::system_error &) {
+						}
+					});
+					
+					fiber.transfer();
+					bound.reactor.run();
+				}
+				
+				// The reactor was destroyed before the function completed:
+				while (pool.metrics().completed == 0) {
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+				
+				examiner.expect(pool.metrics().completed) == 1;
+			}
+		},
+		
+		{"it doesn't resume a fiber which was stopped while waiting",
+			[](UnitTest::Examiner & examiner) {
+				Offload pool(1);
+				bool stopped = false;
+				
+				{
+					Reactor::Bound bound;
+					
+					auto fiber = std::make_unique<Fiber>([&](){
+						auto guard = defer([&]{stopped = true;});
+						
+						pool.run([]{
+							std::this_thread::sleep_for(std::chrono::milliseconds(20));
+						});
+					});
+					
+					fiber->transfer();
+					
+					// Destroying the fiber stops it, unwinding it from the wait:
+					fiber.reset();
+					examiner.expect(stopped) == true;
+					
+					bound.reactor.run();
+				}
+				
+				while (pool.metrics().completed == 0) {
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+				
+				examiner.expect(pool.metrics().completed) == 1;
+			}
+		},
+	};
+}
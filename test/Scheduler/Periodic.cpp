@@ -0,0 +1,136 @@
+//
+//  Periodic.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Periodic.hpp>
+
+#include <chrono>
+#include <thread>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	static double since(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+	
+	UnitTest::Suite PeriodicTestSuite {
+		"Scheduler::Periodic",
+		
+		{"it ticks without drifting",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				
+				double elapsed = 0;
+				std::size_t ticks = 0;
+				
+				Fiber fiber([&](){
+					auto start = std::chrono::steady_clock::now();
+					Periodic periodic(0.01);
+					
+					for (std::size_t i = 0; i < 10; i += 1) {
+						ticks += periodic.wait();
+						
+						// Work done during each tick doesn't delay the next one:
+						std::this_thread::sleep_for(std::chrono::milliseconds(5));
+					}
+					
+					elapsed = since(start);
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(ticks) == 10;
+				// If each tick was scheduled relative to the previous one, the work would accumulate to 150ms:
+				examiner.expect(elapsed >= 0.1 && elapsed < 0.14) == true;
+			}
+		},
+		
+		{"it can deliver missed ticks in a burst",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				
+				std::size_t ticks = 0;
+				double elapsed = 0;
+				
+				Fiber fiber([&](){
+					Periodic periodic(0.02, Periodic::Missed::BURST);
+					
+					std::this_thread::sleep_for(std::chrono::milliseconds(50));
+					
+					auto start = std::chrono::steady_clock::now();
+					for (std::size_t i = 0; i < 2; i += 1) {
+						ticks += periodic.wait();
+					}
+					
+					elapsed = since(start);
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(ticks) == 2;
+				examiner.expect(elapsed < 0.01) == true;
+			}
+		},
+		
+		{"it can coalesce missed ticks",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				
+				std::size_t ticks = 0;
+				
+				Fiber fiber([&](){
+					Periodic periodic(0.02, Periodic::Missed::COALESCE);
+					
+					std::this_thread::sleep_for(std::chrono::milliseconds(50));
+					
+					ticks = periodic.wait();
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(ticks >= 2) == true;
+			}
+		},
+		
+		{"it can skip missed ticks",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				
+				std::size_t ticks = 0, skipped = 0;
+				double elapsed = 0;
+				
+				Fiber fiber([&](){
+					auto start = std::chrono::steady_clock::now();
+					Periodic periodic(0.02, Periodic::Missed::SKIP);
+					
+					std::this_thread::sleep_for(std::chrono::milliseconds(50));
+					
+					ticks = periodic.wait();
+					skipped = periodic.skipped();
+					elapsed = since(start);
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(ticks) == 1;
+				examiner.expect(skipped >= 2) == true;
+				
+				// The tick is delivered at the first deadline which hadn't passed:
+				examiner.expect(elapsed >= 0.02 * (skipped + 1)) == true;
+			}
+		},
+	};
+}
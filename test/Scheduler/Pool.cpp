@@ -0,0 +1,87 @@
+//
+//  Pool.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Pool.hpp>
+#include <Scheduler/After.hpp>
+
+#include <atomic>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite PoolTestSuite {
+		"Scheduler::Pool",
+		
+		{"it runs all spawned fibers",
+			[](UnitTest::Examiner & examiner) {
+				std::atomic<std::size_t> count{0};
+				
+				{
+					Pool pool(2);
+					
+					for (std::size_t i = 0; i < 100; i += 1) {
+						pool.spawn([&]{
+							for (std::size_t j = 0; j < 10; j += 1) {
+								Pool::yield();
+							}
+							
+							count += 1;
+						});
+					}
+				}
+				
+				examiner.expect(count.load()) == 100;
+			}
+		},
+		
+		{"it can spawn fibers from within the pool",
+			[](UnitTest::Examiner & examiner) {
+				std::atomic<std::size_t> count{0};
+				Pool pool(4);
+				
+				pool.spawn([&]{
+					for (std::size_t i = 0; i < 1000; i += 1) {
+						pool.spawn([&]{
+							Pool::yield();
+							count += 1;
+						});
+					}
+				});
+				
+				pool.wait();
+				
+				examiner.expect(count.load()) == 1000;
+			}
+		},
+		
+		{"it resumes waiting fibers on their reactor",
+			[](UnitTest::Examiner & examiner) {
+				std::atomic<std::size_t> count{0};
+				Pool pool(2);
+				
+				for (std::size_t i = 0; i < 10; i += 1) {
+					pool.spawn([&]{
+						auto reactor = Reactor::current;
+						
+						After after(0.01);
+						after.wait();
+						
+						if (Reactor::current == reactor) count += 1;
+					});
+				}
+				
+				pool.wait();
+				
+				examiner.expect(count.load()) == 10;
+			}
+		},
+	};
+}
@@ -0,0 +1,106 @@
+//
+//  Process.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Process.hpp>
+#include <Scheduler/Monitor.hpp>
+
+#include <string>
+
+#include <unistd.h>
+#include <sys/wait.h>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite ProcessTestSuite {
+		"Scheduler::Process",
+		
+		{"it can wait for a process to exit",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				std::optional<int> status;
+				
+				Fiber fiber([&](){
+					Process process({"sh", "-c", "exit 3"});
+					status = process.wait();
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(bool(status)) == true;
+				examiner.expect(WIFEXITED(*status)) == true;
+				examiner.expect(WEXITSTATUS(*status)) == 3;
+			}
+		},
+		
+		{"it can time out waiting for a process",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				bool timed_out = false, killed = false;
+				
+				Fiber fiber([&](){
+					Process process({"sleep", "10"});
+					
+					Timestamp timeout(0.01);
+					timed_out = !process.wait(&timeout);
+					
+					process.kill(SIGTERM);
+					
+					auto status = process.wait();
+					killed = status && WIFSIGNALED(*status);
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(timed_out) == true;
+				examiner.expect(killed) == true;
+			}
+		},
+		
+		{"it can connect standard input and output to pipes",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				std::string output;
+				
+				Fiber fiber([&](){
+					Process process({"cat"}, Process::PIPE);
+					
+					examiner.expect(::write(process.input, "Hello World", 11)) == 11;
+					process.input.close();
+					
+					Monitor monitor(process.output);
+					char buffer[64];
+					
+					while (true) {
+						auto result = ::read(process.output, buffer, sizeof(buffer));
+						
+						if (result > 0) {
+							output.append(buffer, result);
+						} else if (result == -1 && errno == EAGAIN) {
+							monitor.wait_readable();
+						} else {
+							break;
+						}
+					}
+					
+					process.wait();
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(output).to(be == "Hello World");
+			}
+		},
+	};
+}
@@ -0,0 +1,368 @@
+//
+//  Reactor.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Fiber.hpp>
+#include <Scheduler/Reactor.hpp>
+#include <Scheduler/Monitor.hpp>
+
+#include "Pipe.hpp"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite ReactorTestSuite {
+		"Scheduler::Reactor",
+		
+		{"it resumes ready fibers in order",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				std::string order;
+				
+				Fiber target([&](){
+					order += 'A';
+				});
+				
+				Fiber first([&](){
+					bound.reactor.transfer(&target);
+					order += 'B';
+				});
+				
+				first.transfer();
+				
+				bound.reactor.run();
+				
+				examiner.expect(order).to(be == "AB");
+			}
+		},
+		
+		{"it resumes fibers which became ready together in priority order",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				
+				std::string order;
+				std::vector<Pipe> pipes(3);
+				std::vector<std::unique_ptr<Fiber>> fibers;
+				
+				auto priorities = {Reactor::Priority::BACKGROUND, Reactor::Priority::NORMAL, Reactor::Priority::CRITICAL};
+				
+				std::size_t index = 0;
+				for (auto priority : priorities) {
+					auto & pipe = pipes[index++];
+					
+					fibers.push_back(std::make_unique<Fiber>([&, priority](){
+						reactor.set_priority(priority);
+						
+						Monitor monitor(pipe.input);
+						monitor.wait_readable();
+						
+						order += "CNB"[std::size_t(reactor.priority())];
+					}));
+					
+					fibers.back()->transfer();
+				}
+				
+				// All the descriptors become readable in the same iteration:
+				for (auto & pipe : pipes) {
+					examiner.expect(::write(pipe.output, "!", 1)) == 1;
+				}
+				
+				reactor.run();
+				
+				examiner.expect(order).to(be == "CNB");
+			}
+		},
+		
+		{"it prevents background fibers from starving",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				
+				reactor.set_starvation_limit(4);
+				
+				std::size_t critical = 0, background = 0;
+				bool done = false;
+				
+				Fiber busy([&](){
+					reactor.set_priority(Reactor::Priority::CRITICAL);
+					
+					// Keep yielding, so there is always a critical fiber in the ready list:
+					while (!done) {
+						critical += 1;
+						reactor.transfer(&Fiber::main);
+					}
+				});
+				
+				busy.transfer();
+				
+				Fiber slow([&](){
+					reactor.set_priority(Reactor::Priority::BACKGROUND);
+					
+					for (std::size_t i = 0; i < 10; i += 1) {
+						background += 1;
+						reactor.transfer(&Fiber::main);
+					}
+					
+					done = true;
+				});
+				
+				slow.transfer();
+				reactor.run();
+				
+				examiner.expect(background) == 10;
+				examiner.expect(critical <= 10 * 5 + 1) == true;
+			}
+		},
+		
+		{"it can resume fibers from other threads",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				
+				std::size_t resumed = 0;
+				
+				Fiber fiber([&](){
+					auto fiber = Fiber::current;
+					
+					for (std::size_t i = 0; i < 100; i += 1) {
+						std::thread thread([&]{
+							reactor.resume(fiber);
+						});
+						
+						reactor.transfer();
+						resumed += 1;
+						
+						thread.join();
+					}
+				});
+				
+				fiber.transfer();
+				reactor.run();
+				
+				examiner.expect(resumed) == 100;
+			}
+		},
+		
+		{"it resumes fibers from other threads in priority order",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				auto pipe = Pipe();
+				
+				std::string order;
+				
+				Fiber background([&](){
+					reactor.transfer();
+					order += 'B';
+				});
+				
+				background.transfer();
+				
+				Fiber critical([&](){
+					reactor.set_priority(Reactor::Priority::CRITICAL);
+					
+					Monitor monitor(pipe.input);
+					monitor.wait_readable();
+					
+					order += 'C';
+				});
+				
+				critical.transfer();
+				
+				// Both fibers become ready in the same iteration:
+				std::thread thread([&]{
+					reactor.resume(&background, Reactor::Priority::BACKGROUND);
+				});
+				
+				thread.join();
+				examiner.expect(::write(pipe.output, "!", 1)) == 1;
+				
+				reactor.run();
+				
+				examiner.expect(order).to(be == "CB");
+			}
+		},
+		
+		{"it invokes callables posted from other threads",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				
+				std::size_t count = 0;
+				
+				std::thread thread([&]{
+					for (std::size_t i = 0; i < 1000; i += 1) {
+						reactor.post([&]{count += 1;});
+					}
+				});
+				
+				thread.join();
+				
+				reactor.run_once(Duration(0));
+				
+				examiner.expect(count) == 1000;
+			}
+		},
+		
+		{"it can busy poll before blocking",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				
+				reactor.set_busy_poll(0.1);
+				
+				Fiber fiber([&](){
+					auto fiber = Fiber::current;
+					
+					for (std::size_t i = 0; i < 10; i += 1) {
+						std::thread thread([&]{
+							std::this_thread::sleep_for(std::chrono::microseconds(100));
+							reactor.resume(fiber);
+						});
+						
+						reactor.transfer();
+						
+						thread.join();
+					}
+				});
+				
+				fiber.transfer();
+				reactor.run();
+				
+				auto & busy_poll = reactor.busy_poll();
+				
+				examiner.expect(busy_poll.spins >= 10) == true;
+				examiner.expect(busy_poll.hits >= 10) == true;
+				examiner.expect(busy_poll.time > 0) == true;
+			}
+		},
+		
+		{"it can ask the kernel to busy poll",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				
+				// This is only supported by epoll, on Linux 6.9 or later:
+				auto supported = bound.reactor.set_kernel_busy_poll(50, 8);
+				
+				bool slept = false;
+				
+				Fiber fiber([&](){
+					slept = bound.reactor.sleep(Fiber::current, 0.001);
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(slept) == true;
+				
+				// Disabling it is supported whenever enabling it was:
+				examiner.expect(bound.reactor.set_kernel_busy_poll(0, 0)) == supported;
+			}
+		},
+		
+		{"it records metrics",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				
+				reactor.set_metrics(true);
+				
+				std::uint64_t waits = 0;
+				
+				Fiber fiber([&](){
+					reactor.set_waits(&waits);
+					
+					for (std::size_t i = 0; i < 10; i += 1) {
+						reactor.sleep(Fiber::current, 0.001);
+					}
+				});
+				
+				fiber.transfer();
+				reactor.run();
+				
+				auto metrics = reactor.metrics();
+				
+				examiner.expect(metrics.waits) == 10;
+				examiner.expect(waits) == 10;
+				examiner.expect(metrics.timer_lateness.count()) == 10;
+				examiner.expect(metrics.iterations >= 10) == true;
+				examiner.expect(metrics.select_time > 0) == true;
+				
+				reactor.reset_metrics();
+				examiner.expect(reactor.metrics().waits) == 0;
+			}
+		},
+		
+		{"it can transfer between fibers",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				
+				const std::size_t count = 1000;
+				std::size_t transfers = 0;
+				
+				// Each transfer places the first fiber on the ready list, and the reactor resumes it:
+				Fiber target([&](){
+					Fiber::current->transient = true;
+					
+					while (true) {
+						bound.reactor.transfer();
+					}
+				});
+				
+				target.transfer();
+				
+				Fiber fiber([&](){
+					while (transfers < count) {
+						transfers += 1;
+						bound.reactor.transfer(&target);
+					}
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(transfers).to(be == count);
+			}
+		},
+		
+		{"it doesn't spin while a descriptor stays ready",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto & reactor = bound.reactor;
+				auto pipe = Pipe(true);
+				
+				reactor.set_metrics(true);
+				
+				Fiber fiber([&](){
+					Monitor monitor(pipe.input);
+					
+					// The socket stays writable, while nothing is waiting for it to be:
+					monitor.wait_writable();
+					
+					Timestamp timeout(0.05);
+					monitor.wait_readable(&timeout);
+				});
+				
+				fiber.transfer();
+				reactor.run();
+				
+				examiner.expect(reactor.metrics().iterations < 10) == true;
+			}
+		},
+	};
+}
@@ -0,0 +1,198 @@
+//
+//  Runtime.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Runtime.hpp>
+#include <Scheduler/Mailbox.hpp>
+#include <Scheduler/Deadline.hpp>
+#include <Scheduler/IO.hpp>
+
+#include <atomic>
+#include <set>
+
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	// Two cores, which share a CPU if there is only one.
+	static std::vector<int> two_cores()
+	{
+		auto cpus = Runtime::available();
+		
+		return {cpus.front(), cpus.back()};
+	}
+	
+	static sockaddr_in loopback(in_port_t port = 0)
+	{
+		sockaddr_in address = {};
+		address.sin_family = AF_INET;
+		address.sin_port = htons(port);
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		
+		return address;
+	}
+	
+	// Connect to the address with blocking sockets, which complete as soon as the connection is in the listener's backlog.
+	static std::vector<Handle> connect(const sockaddr_in & address, std::size_t count)
+	{
+		std::vector<Handle> connections;
+		
+		for (std::size_t i = 0; i < count; i += 1) {
+			Handle connection(::socket(AF_INET, SOCK_STREAM, 0));
+			
+			if (::connect(connection, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == -1)
+				throw std::system_error(errno, std::generic_category(), "connect");
+			
+			connections.push_back(std::move(connection));
+		}
+		
+		return connections;
+	}
+	
+	// Accept connections until the deadline expires.
+	static std::size_t accept_all(Descriptor listener)
+	{
+		std::size_t count = 0;
+		Deadline deadline(0.2);
+		
+		try {
+			while (true) {
+				Handle connection(IO::accept(listener));
+				count += 1;
+			}
+		} catch (std::system_error &) {
+			// The deadline expired.
+		}
+		
+		return count;
+	}
+	
+	UnitTest::Suite RuntimeTestSuite {
+		"Scheduler::Runtime",
+		
+		{"it runs fibers on each core",
+			[](UnitTest::Examiner & examiner) {
+				std::mutex mutex;
+				std::set<std::size_t> cores;
+				std::set<std::thread::id> threads;
+				std::atomic<bool> consistent{true};
+				
+				{
+					Runtime runtime(two_cores());
+					
+					examiner.expect(runtime.size()) == 2;
+					
+					runtime.spawn_all([&](std::size_t core){
+						if (Runtime::current() != core || Reactor::current != &runtime.reactor(core)) {
+							consistent = false;
+						}
+						
+						// Fibers can wait on their core's reactor:
+						Reactor::current->sleep(Fiber::current, 0.001);
+						
+						std::lock_guard<std::mutex> lock(mutex);
+						cores.insert(core);
+						threads.insert(std::this_thread::get_id());
+					});
+				}
+				
+				examiner.expect(consistent.load()) == true;
+				examiner.expect(cores.size()) == 2;
+				examiner.expect(threads.size()) == 2;
+			}
+		},
+		
+		{"it can send messages to a fiber on another core",
+			[](UnitTest::Examiner & examiner) {
+				Runtime runtime(two_cores());
+				
+				std::size_t total = 0, received = 0;
+				
+				runtime.spawn(0, [&]{
+					Mailbox<std::size_t> mailbox;
+					
+					runtime.spawn(1, [&]{
+						for (std::size_t i = 1; i <= 100; i += 1) {
+							mailbox.send(i);
+						}
+					});
+					
+					while (received < 100) {
+						total += *mailbox.receive();
+						received += 1;
+					}
+				});
+				
+				runtime.wait();
+				
+				examiner.expect(received) == 100;
+				examiner.expect(total) == 5050;
+			}
+		},
+		
+		{"it can listen on each core with the same port",
+			[](UnitTest::Examiner & examiner) {
+				auto address = loopback();
+				
+				auto first = Runtime::listen(reinterpret_cast<sockaddr *>(&address), sizeof(address));
+				
+				socklen_t length = sizeof(address);
+				::getsockname(first, reinterpret_cast<sockaddr *>(&address), &length);
+				
+				auto second = Runtime::listen(reinterpret_cast<sockaddr *>(&address), sizeof(address));
+				
+				auto connections = connect(address, 16);
+				
+				std::atomic<std::size_t> accepted{0};
+				
+				{
+					Runtime runtime(two_cores());
+					Descriptor listeners[2] = {first, second};
+					
+					runtime.spawn_all([&](std::size_t core){
+						accepted += accept_all(listeners[core]);
+					});
+				}
+				
+				examiner.expect(accepted.load()) == 16;
+			}
+		},
+		
+		{"it can share a listener between cores",
+			[](UnitTest::Examiner & examiner) {
+				auto address = loopback();
+				auto listener = Runtime::listen(reinterpret_cast<sockaddr *>(&address), sizeof(address));
+				
+				socklen_t length = sizeof(address);
+				::getsockname(listener, reinterpret_cast<sockaddr *>(&address), &length);
+				
+				std::atomic<std::size_t> accepted{0};
+				
+				{
+					Runtime runtime(two_cores());
+					
+					runtime.spawn_all([&](std::size_t){
+						Reactor::current->exclusive(listener);
+						
+						accepted += accept_all(listener);
+					});
+					
+					auto connections = connect(address, 16);
+					runtime.wait();
+				}
+				
+				examiner.expect(accepted.load()) == 16;
+			}
+		},
+	};
+}
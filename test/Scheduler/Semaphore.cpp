@@ -12,6 +12,9 @@
 #include <Scheduler/Reactor.hpp>
 #include <Scheduler/After.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace Scheduler
 {
 	using namespace UnitTest::Expectations;
@@ -82,6 +85,76 @@ namespace Scheduler
 				examiner.expect(semaphore.count()).to(be == 1);
 				examiner.expect(order).to(be == "ABCDEF");
 			}
-		}
+		},
+		
+		{"it can wake fibers without transferring to them",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Semaphore semaphore(0, Semaphore::Mode::READY);
+				std::string order;
+				
+				std::vector<std::unique_ptr<Fiber>> waiters;
+				
+				for (std::size_t i = 0; i < 3; i += 1) {
+					waiters.push_back(std::make_unique<Fiber>([&](){
+						semaphore.wait();
+						order += 'W';
+					}));
+					
+					waiters.back()->transfer();
+				}
+				
+				Fiber signaller([&](){
+					semaphore.broadcast();
+					
+					// The woken fibers only run once the signaller stops:
+					order += 'S';
+				});
+				
+				signaller.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(order).to(be == "SWWW");
+			}
+		},
+		
+		{"it hands the semaphore to the first waiter",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Semaphore semaphore(1, Semaphore::Mode::HANDOFF);
+				std::string order;
+				
+				Fiber first_fiber([&](){
+					semaphore.acquire();
+					order += 'A';
+					
+					// Wait for the second fiber to start waiting:
+					bound.reactor.transfer(&Fiber::main);
+					
+					semaphore.release();
+					
+					// The semaphore was handed to the second fiber, so we can't take it back:
+					examiner.expect(semaphore.count()).to(be == 0);
+					
+					semaphore.acquire();
+					order += 'C';
+					semaphore.release();
+				});
+				
+				first_fiber.transfer();
+				
+				Fiber second_fiber([&](){
+					semaphore.acquire();
+					order += 'B';
+					semaphore.release();
+				});
+				
+				second_fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(semaphore.count()).to(be == 1);
+				examiner.expect(order).to(be == "ABC");
+			}
+		},
 	};
 }
@@ -0,0 +1,88 @@
+//
+//  Signals.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Signals.hpp>
+
+#include <vector>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite SignalsTestSuite {
+		"Scheduler::Signals",
+		
+		{"it can wait for a signal",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Signals signals{SIGUSR1};
+				
+				int signal = 0;
+				
+				Fiber fiber([&](){
+					signal = signals.wait();
+				});
+				
+				fiber.transfer();
+				
+				// Directed at this thread, where the signal is blocked:
+				::raise(SIGUSR1);
+				
+				bound.reactor.run();
+				
+				examiner.expect(signal) == SIGUSR1;
+			}
+		},
+		
+		{"it reads queued signals in one batch",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Signals signals{SIGUSR1, SIGUSR2};
+				
+				::raise(SIGUSR1);
+				::raise(SIGUSR2);
+				
+				std::vector<int> received;
+				std::size_t pending = 0;
+				
+				Fiber fiber([&](){
+					received.push_back(signals.wait());
+					pending = signals.pending();
+					received.push_back(signals.wait());
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(received.size()) == 2;
+				examiner.expect(pending) == 1;
+			}
+		},
+		
+		{"it can time out",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Signals signals{SIGUSR1};
+				
+				int signal = -1;
+				
+				Fiber fiber([&](){
+					Timestamp timeout(0.01);
+					signal = signals.wait(&timeout);
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(signal) == 0;
+			}
+		},
+	};
+}
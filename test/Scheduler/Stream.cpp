@@ -0,0 +1,187 @@
+//
+//  Stream.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Stream.hpp>
+#include <Scheduler/Fiber.hpp>
+
+#include "Pipe.hpp"
+
+#include <unistd.h>
+
+#include <string>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite StreamTestSuite {
+		"Scheduler::Stream",
+		
+		{"it can read lines",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe pipe(true);
+				
+				std::vector<std::string> lines;
+				bool ended = false;
+				
+				Fiber server([&](){
+					Stream stream(std::move(pipe.input));
+					
+					while (auto line = stream.read_until("\r\n")) {
+						lines.emplace_back(*line);
+					}
+					
+					ended = stream.buffered().empty();
+				});
+				
+				server.transfer();
+				
+				Fiber client([&](){
+					Stream stream(std::move(pipe.output));
+					
+					stream.write("Hello\r");
+					stream.flush();
+					
+					// The delimiter is split between writes:
+					stream.write("\nWorld\r\n\r\n");
+					stream.flush();
+				});
+				
+				client.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(lines.size()) == 3;
+				examiner.expect(lines[0]) == "Hello";
+				examiner.expect(lines[1]) == "World";
+				examiner.expect(lines[2]) == "";
+				examiner.expect(ended) == true;
+			}
+		},
+		
+		{"it queues small writes until they are flushed",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe pipe(true);
+				
+				Fiber fiber([&](){
+					Stream stream(std::move(pipe.output));
+					char buffer[16];
+					
+					stream.write("Hello ");
+					stream.write("World");
+					
+					examiner.expect(stream.pending()) == 11;
+					examiner.expect(::read(pipe.input, buffer, sizeof(buffer))) == -1;
+					
+					stream.flush();
+					
+					examiner.expect(stream.pending()) == 0;
+					examiner.expect(::read(pipe.input, buffer, sizeof(buffer))) == 11;
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+			}
+		},
+		
+		{"it reads ahead into its own buffer",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe pipe(true);
+				
+				examiner.expect(::write(pipe.output, "abcdef", 6)) == 6;
+				
+				Fiber fiber([&](){
+					Stream stream(std::move(pipe.input));
+					char buffer[2];
+					
+					examiner.expect(stream.read(buffer, sizeof(buffer))) == 2;
+					examiner.expect(stream.buffered()) == "cdef";
+					
+					// This is served from the buffer, without a system call:
+					examiner.expect(stream.read(buffer, sizeof(buffer))) == 2;
+					examiner.expect(std::string(buffer, 2)) == "cd";
+					
+					examiner.expect(*stream.read_exactly(2)) == "ef";
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+			}
+		},
+		
+		{"it can transfer more data than the buffers hold",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe pipe(true);
+				
+				const std::size_t size = 1024 * 1024;
+				std::string sent(size, 'x'), received;
+				
+				for (std::size_t i = 0; i < size; i += 1) {
+					sent[i] = 'a' + (i % 26);
+				}
+				
+				Fiber server([&](){
+					Stream stream(std::move(pipe.input), 64);
+					
+					if (auto data = stream.read_exactly(size)) {
+						received = *data;
+					}
+				});
+				
+				server.transfer();
+				
+				Fiber client([&](){
+					Stream stream(std::move(pipe.output), 64);
+					
+					// Some small writes which are queued, followed by one which is too big to queue:
+					stream.write(sent.data(), 10);
+					stream.write(sent.data() + 10, 20);
+					stream.write(sent.data() + 30, size - 30);
+					stream.flush();
+				});
+				
+				client.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(received.size()) == size;
+				examiner.expect(received == sent) == true;
+			}
+		},
+		
+		{"it fails if the delimiter isn't found within the limit",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe pipe(true);
+				
+				examiner.expect(::write(pipe.output, "a very long line\n", 17)) == 17;
+				
+				int error = 0;
+				
+				Fiber fiber([&](){
+					Stream stream(std::move(pipe.input));
+					
+					try {
+						stream.read_until("\n", 4);
+					} catch (std::system_error & exception) {
+						error = exception.code().value();
+					}
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(error) == EMSGSIZE;
+			}
+		},
+	};
+}
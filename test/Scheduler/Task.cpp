@@ -0,0 +1,231 @@
+//
+//  Task.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Task.hpp>
+
+#if defined(__cpp_impl_coroutine)
+
+#include "Pipe.hpp"
+
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	static Task<std::string> read_message(Descriptor descriptor)
+	{
+		Monitor monitor(descriptor);
+		std::string message;
+		char buffer[32];
+		
+		while (true) {
+			auto result = ::read(descriptor, buffer, sizeof(buffer));
+			
+			if (result > 0) {
+				message.append(buffer, result);
+			} else if (result == 0) {
+				break;
+			} else {
+				co_await monitor.readable();
+			}
+		}
+		
+		co_return message;
+	}
+	
+	static Task<int> add(int a, int b)
+	{
+		co_await After(0.001);
+		
+		co_return a + b;
+	}
+	
+	UnitTest::Suite TaskTestSuite {
+		"Scheduler::Task",
+		
+		{"it can be awaited by a fiber",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				int result = 0;
+				
+				Fiber fiber([&](){
+					result = add(1, 2).wait();
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(result) == 3;
+			}
+		},
+		
+		{"it can await other tasks",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				int result = 0;
+				
+				auto sum = []() -> Task<int> {
+					int total = 0;
+					
+					for (int i = 0; i < 10; i += 1) {
+						total += co_await add(total, 1);
+					}
+					
+					co_return total;
+				};
+				
+				Fiber fiber([&](){
+					result = sum().wait();
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(result) == 1023;
+			}
+		},
+		
+		{"it can wait for a descriptor written by a fiber",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe pipe;
+				std::string message;
+				
+				Fiber reader([&](){
+					message = read_message(pipe.input).wait();
+				});
+				
+				reader.transfer();
+				
+				Fiber writer([&](){
+					::write(pipe.output, "Hello ", 6);
+					bound.reactor.sleep(Fiber::current, 0.001);
+					::write(pipe.output, "World", 5);
+					
+					pipe.output.close();
+				});
+				
+				writer.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(message) == "Hello World";
+			}
+		},
+		
+		{"it can share a semaphore with fibers",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Semaphore semaphore(1);
+				std::string order;
+				
+				auto critical = [&](char name) -> Task<> {
+					co_await semaphore;
+					
+					order += name;
+					co_await After(0.001);
+					order += name;
+					
+					semaphore.release();
+				};
+				
+				critical('a').detach();
+				critical('b').detach();
+				
+				Fiber fiber([&](){
+					Semaphore::Acquire acquire(semaphore);
+					
+					order += 'f';
+					bound.reactor.sleep(Fiber::current, 0.001);
+					order += 'f';
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(order) == "aabbff";
+			}
+		},
+		
+		{"it stops waiting when the semaphore is destroyed",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				auto semaphore = std::make_unique<Semaphore>(0);
+				int error = 0;
+				
+				auto acquire = [&]() -> Task<> {
+					co_await *semaphore;
+				};
+				
+				Fiber fiber([&](){
+					try {
+						acquire().wait();
+					} catch (std::system_error & exception) {
+						error = exception.code().value();
+					}
+				});
+				
+				fiber.transfer();
+				semaphore.reset();
+				
+				bound.reactor.run();
+				
+				examiner.expect(error) == ECANCELED;
+			}
+		},
+		
+		{"it keeps the reactor running while a detached task waits",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				bool finished = false;
+				
+				auto sleeper = [&]() -> Task<> {
+					co_await After(0.01);
+					finished = true;
+				};
+				
+				sleeper().detach();
+				bound.reactor.run();
+				
+				examiner.expect(finished) == true;
+			}
+		},
+		
+		{"it rethrows exceptions when awaited",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				bool caught = false;
+				
+				auto failing = []() -> Task<> {
+					co_await After(0.001);
+					throw std::runtime_error("failed");
+				};
+				
+				Fiber fiber([&](){
+					try {
+						failing().wait();
+					} catch (std::runtime_error &) {
+						caught = true;
+					}
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(caught) == true;
+			}
+		},
+	};
+}
+
+#endif
@@ -0,0 +1,138 @@
+//
+//  Transfer.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Transfer.hpp>
+#include <Scheduler/Fiber.hpp>
+#include <Scheduler/Reactor.hpp>
+#include <Scheduler/IO.hpp>
+
+#include "Pipe.hpp"
+
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	UnitTest::Suite TransferTestSuite {
+		"Scheduler::transfer",
+		
+		{"it moves data between sockets until the end of the stream",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe source(true), destination(true);
+				
+				const std::size_t size = 1024 * 1024;
+				std::string sent(size, 'x'), received;
+				std::size_t moved = 0;
+				
+				for (std::size_t i = 0; i < size; i += 1) {
+					sent[i] = 'a' + (i % 26);
+				}
+				
+				Fiber writer([&](){
+					for (std::size_t offset = 0; offset < size;) {
+						offset += IO::write(source.output, sent.data() + offset, size - offset);
+					}
+					
+					source.output.close();
+				});
+				
+				Fiber proxy([&](){
+					moved = transfer(source.input, destination.output);
+					
+					destination.output.close();
+				});
+				
+				Fiber reader([&](){
+					char buffer[1024 * 16];
+					
+					while (auto count = IO::read(destination.input, buffer, sizeof(buffer))) {
+						received.append(buffer, count);
+					}
+				});
+				
+				writer.transfer();
+				proxy.transfer();
+				reader.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(moved) == size;
+				examiner.expect(received == sent) == true;
+			}
+		},
+		
+		{"it moves at most the specified length",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe source, destination;
+				
+				examiner.expect(::write(source.output, "Hello World", 11)) == 11;
+				
+				Fiber fiber([&](){
+					examiner.expect(transfer(source.input, destination.output, 5)) == 5;
+				});
+				
+				fiber.transfer();
+				bound.reactor.run();
+				
+				char buffer[16];
+				
+				examiner.expect(::read(destination.input, buffer, sizeof(buffer))) == 5;
+				examiner.expect(std::string(buffer, 5)) == "Hello";
+				examiner.expect(::read(source.input, buffer, sizeof(buffer))) == 6;
+			}
+		},
+		
+		{"it can send a regular file",
+			[](UnitTest::Examiner & examiner) {
+				Reactor::Bound bound;
+				Pipe destination(true);
+				
+				char path[] = "/tmp/transfer-XXXXXX";
+				Handle file(::mkstemp(path));
+				::unlink(path);
+				
+				std::string content(100000, 'f');
+				
+				examiner.expect(::write(file, content.data(), content.size())) == content.size();
+				::lseek(file, 0, SEEK_SET);
+				
+				std::size_t first = 0, second = 0;
+				std::string received;
+				
+				Fiber sender([&](){
+					first = transfer(file, destination.output, 1000);
+					second = transfer(file, destination.output);
+					
+					destination.output.close();
+				});
+				
+				Fiber reader([&](){
+					char buffer[1024 * 16];
+					
+					while (auto count = IO::read(destination.input, buffer, sizeof(buffer))) {
+						received.append(buffer, count);
+					}
+				});
+				
+				sender.transfer();
+				reader.transfer();
+				bound.reactor.run();
+				
+				examiner.expect(first) == 1000;
+				examiner.expect(second) == content.size() - 1000;
+				examiner.expect(received == content) == true;
+			}
+		},
+	};
+}
@@ -0,0 +1,89 @@
+//
+//  Wheel.cpp
+//  This file is part of the "Scheduler" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 18/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Scheduler/Wheel.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Scheduler
+{
+	using namespace UnitTest::Expectations;
+	
+	struct Append
+	{
+		std::string * order = nullptr;
+		char value = 0;
+		
+		void operator()() {*order += value;}
+		explicit operator bool() const noexcept {return order != nullptr;}
+	};
+	
+	static void run_until_empty(Wheel<Append> & wheel)
+	{
+		while (auto timestamp = wheel.next_timestamp()) {
+			auto timespec = Duration(*timestamp).as_timespec();
+			std::this_thread::sleep_for(std::chrono::seconds(timespec.tv_sec) + std::chrono::nanoseconds(timespec.tv_nsec));
+			wheel.run();
+		}
+	}
+	
+	UnitTest::Suite WheelTestSuite {
+		"Scheduler::Wheel",
+		
+		{"it fires events in order",
+			[](UnitTest::Examiner & examiner) {
+				Wheel<Append> wheel(0.0001);
+				std::string order;
+				
+				// These span several levels of the wheel:
+				wheel.schedule(0.05, Append{&order, 'D'});
+				wheel.schedule(0.0002, Append{&order, 'A'});
+				wheel.schedule(0.02, Append{&order, 'C'});
+				wheel.schedule(0.008, Append{&order, 'B'});
+				
+				examiner.expect(wheel.size()).to(be == 4);
+				
+				run_until_empty(wheel);
+				
+				examiner.expect(order).to(be == "ABCD");
+				examiner.expect(wheel.size()).to(be == 0);
+			}
+		},
+		
+		{"it removes cancelled events",
+			[](UnitTest::Examiner & examiner) {
+				Wheel<Append> wheel(0.001);
+				std::string order;
+				
+				std::vector<Wheel<Append>::EventReference> events;
+				
+				for (std::size_t i = 0; i < 1000; i += 1) {
+					events.push_back(wheel.schedule(60.0, Append{&order, 'X'}));
+				}
+				
+				auto event = wheel.schedule(0.001, Append{&order, 'A'});
+				examiner.expect(bool(event)).to(be == true);
+				
+				for (auto & event : events) {
+					event.cancel();
+				}
+				
+				examiner.expect(wheel.size()).to(be == 1);
+				
+				run_until_empty(wheel);
+				
+				examiner.expect(order).to(be == "A");
+				examiner.expect(bool(event)).to(be == false);
+			}
+		},
+	};
+}